@@ -0,0 +1,59 @@
+# employee_core: the employee classes from concepts/employee as a static
+# library, shared by the employee demos and benchmarks. Included from the
+# top-level CMakeLists.txt before any concept directory is added, so every
+# concept can call link_employee_core() whatever order they are found in.
+
+set(EMPLOYEE_CORE_DIR ${PROJECT_SOURCE_DIR}/concepts/employee)
+
+# Cross-check cached payroll totals against a full recompute on every query
+option(EMPLOYEE_DEBUG_TOTALS "Verify incremental payroll totals" OFF)
+
+# Scoped timers and counters on the hot paths, dumped as JSON from the demo
+option(EMPLOYEE_INSTRUMENTATION "Time and count employee hot paths" OFF)
+
+# Link-time optimization for employee_core and everything that links it, so
+# virtual calls into the final leaf classes can be devirtualized across files
+option(EMPLOYEE_LTO "Build employee_core and its users with LTO" ON)
+
+# Everything except the interactive main() goes into employee_core, which
+# both employee demos and all benchmarks link instead of recompiling it
+file(GLOB EMPLOYEE_CORE_SOURCES "${EMPLOYEE_CORE_DIR}/*.cpp")
+list(FILTER EMPLOYEE_CORE_SOURCES EXCLUDE REGEX "/main\\.cpp$")
+add_library(employee_core STATIC ${EMPLOYEE_CORE_SOURCES})
+target_include_directories(employee_core PUBLIC ${EMPLOYEE_CORE_DIR})
+if(NOT CMAKE_BUILD_TYPE AND NOT MSVC)
+    target_compile_options(employee_core PRIVATE -O2)
+endif()
+
+# EmployeeManagement.cpp is compiled into each user, so the switches are
+# public
+if(EMPLOYEE_DEBUG_TOTALS)
+    target_compile_definitions(employee_core PUBLIC EMPLOYEE_DEBUG_TOTALS)
+endif()
+if(EMPLOYEE_INSTRUMENTATION)
+    target_compile_definitions(employee_core PUBLIC EMPLOYEE_INSTRUMENTATION)
+endif()
+
+# Payroll reductions use std::thread
+find_package(Threads REQUIRED)
+target_link_libraries(employee_core PUBLIC Threads::Threads)
+
+if(EMPLOYEE_LTO)
+    include(CheckIPOSupported)
+    check_ipo_supported(RESULT EMPLOYEE_LTO_SUPPORTED OUTPUT EMPLOYEE_LTO_OUTPUT LANGUAGES CXX)
+    if(EMPLOYEE_LTO_SUPPORTED)
+        set_property(TARGET employee_core PROPERTY INTERPROCEDURAL_OPTIMIZATION TRUE)
+    else()
+        message(WARNING "EMPLOYEE_LTO: ${EMPLOYEE_LTO_OUTPUT}")
+    endif()
+endif()
+
+# link_employee_core(<target>) links employee_core and matches its LTO
+# setting; LTO objects cannot be linked into a non-LTO target
+function(link_employee_core TARGET_NAME)
+    target_link_libraries(${TARGET_NAME} PRIVATE employee_core)
+    get_target_property(CORE_LTO employee_core INTERPROCEDURAL_OPTIMIZATION)
+    if(CORE_LTO)
+        set_property(TARGET ${TARGET_NAME} PROPERTY INTERPROCEDURAL_OPTIMIZATION TRUE)
+    endif()
+endfunction()
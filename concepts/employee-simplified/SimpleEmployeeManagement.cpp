@@ -1,21 +1,25 @@
-#ifndef EMPLOYEEMANAGEMENT_CPP
-#define EMPLOYEEMANAGEMENT_CPP
+#ifndef SIMPLEEMPLOYEEMANAGEMENT_CPP
+#define SIMPLEEMPLOYEEMANAGEMENT_CPP
 
+#include <iostream>
 #include <vector>
-#include "OfficeEmployee.cpp"
-#include "Worker.cpp"
+#include "OfficeEmployee.h"
+#include "Worker.h"
+using namespace std;
 
-class EmployeeManagement
+// The plain list-of-pointers manager. Employee, OfficeEmployee and Worker
+// come from employee_core, shared with concepts/employee.
+class SimpleEmployeeManagement
 {
 private:
 	vector<Employee *> employeeList;
 
 public:
-	EmployeeManagement()
+	SimpleEmployeeManagement()
 	{
 	}
 
-	~EmployeeManagement()
+	~SimpleEmployeeManagement()
 	{
 		for (Employee *e : employeeList)
 		{
@@ -125,4 +129,4 @@ public:
 	}
 };
 
-#endif // EMPLOYEEMANAGEMENT_CPP
+#endif // SIMPLEEMPLOYEEMANAGEMENT_CPP
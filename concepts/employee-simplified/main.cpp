@@ -1,4 +1,4 @@
-#include "EmployeeManagement.cpp"
+#include "SimpleEmployeeManagement.cpp"
 
 void displayMenu()
 {
@@ -17,7 +17,7 @@ void displayMenu()
 
 int main()
 {
-	EmployeeManagement manager;
+	SimpleEmployeeManagement manager;
 	int choice;
 
 	do
@@ -0,0 +1,214 @@
+#include "BirthDate.h"
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+namespace
+{
+	const int MONTH_LENGTH[2][12] = {
+			{31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31},
+			{31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31}};
+	const int MONTH_START[2][12] = {
+			{0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334},
+			{0, 31, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335}};
+
+	// Day number of 01/01 for every four-digit year, so converting a parsed
+	// date is three table lookups instead of fromCivil()'s arithmetic.
+	struct YearTable
+	{
+		int32_t start[10001];
+
+		YearTable()
+		{
+			for (int year = 0; year <= 10000; year++)
+			{
+				start[year] = BirthDate::fromCivil(year, 1, 1);
+			}
+		}
+	};
+
+	const int32_t *yearStarts()
+	{
+		static const YearTable table;
+		return table.start;
+	}
+
+	// year is 0-9999, as read from four digits.
+	bool fromFields(const int32_t *yearStart, int day, int month, int year, int32_t &days)
+	{
+		unsigned m = static_cast<unsigned>(month - 1);
+		if (m > 11 || day < 1)
+		{
+			return false;
+		}
+		int leap = yearStart[year + 1] - yearStart[year] - 365;
+		if (day > MONTH_LENGTH[leap][m])
+		{
+			return false;
+		}
+		days = yearStart[year] + MONTH_START[leap][m] + day - 1;
+		return true;
+	}
+
+	bool parseDigits(const int32_t *yearStart, string_view text, int32_t &days)
+	{
+		if (text.size() != 10 || text[2] != '/' || text[5] != '/')
+		{
+			return false;
+		}
+		static const int digitAt[8] = {0, 1, 3, 4, 6, 7, 8, 9};
+		int d[8];
+		for (int i = 0; i < 8; i++)
+		{
+			unsigned digit = static_cast<unsigned>(text[digitAt[i]] - '0');
+			if (digit > 9)
+			{
+				return false;
+			}
+			d[i] = static_cast<int>(digit);
+		}
+		int day = d[0] * 10 + d[1];
+		int month = d[2] * 10 + d[3];
+		int year = d[4] * 1000 + d[5] * 100 + d[6] * 10 + d[7];
+		return fromFields(yearStart, day, month, year, days);
+	}
+
+#if defined(__SSE2__)
+	// One date per register: the digit and slash positions are checked with
+	// two compares, and the digit pairs are folded into day, month and year
+	// with one multiply-add per half.
+	bool parseSse2(const int32_t *yearStart, string_view text, int32_t &days)
+	{
+		if (text.size() != 10)
+		{
+			return false;
+		}
+		uint16_t tail;
+		memcpy(&tail, text.data() + 8, sizeof(tail));
+		__m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(text.data()));
+		v = _mm_insert_epi16(v, tail, 4);
+		__m128i d = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+		int digits = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(9)), d));
+		int slashes = _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('/')));
+		if ((digits & 0x3DB) != 0x3DB || (slashes & 0x24) != 0x24)
+		{
+			return false;
+		}
+
+		__m128i zero = _mm_setzero_si128();
+		__m128i lo = _mm_madd_epi16(_mm_unpacklo_epi8(d, zero), _mm_setr_epi16(10, 1, 0, 10, 1, 0, 1000, 100));
+		__m128i hi = _mm_madd_epi16(_mm_unpackhi_epi8(d, zero), _mm_setr_epi16(10, 1, 0, 0, 0, 0, 0, 0));
+		int day = _mm_cvtsi128_si32(lo);
+		int month = _mm_cvtsi128_si32(_mm_srli_si128(lo, 4)) + _mm_cvtsi128_si32(_mm_srli_si128(lo, 8));
+		int year = _mm_cvtsi128_si32(_mm_srli_si128(lo, 12)) + _mm_cvtsi128_si32(hi);
+		return fromFields(yearStart, day, month, year, days);
+	}
+#endif
+}
+
+namespace BirthDate
+{
+	// Howard Hinnant's days_from_civil / civil_from_days.
+	int32_t fromCivil(int year, int month, int day)
+	{
+		year -= month <= 2;
+		int era = (year >= 0 ? year : year - 399) / 400;
+		int yoe = year - era * 400;
+		int doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+		int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+		return era * 146097 + doe - 719468;
+	}
+
+	void toCivil(int32_t days, int &year, int &month, int &day)
+	{
+		days += 719468;
+		int era = (days >= 0 ? days : days - 146096) / 146097;
+		int doe = days - era * 146097;
+		int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+		int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+		int mp = (5 * doy + 2) / 153;
+		day = doy - (153 * mp + 2) / 5 + 1;
+		month = mp < 10 ? mp + 3 : mp - 9;
+		year = yoe + era * 400 + (month <= 2);
+	}
+
+	bool parse(string_view text, int32_t &days)
+	{
+		return parseDigits(yearStarts(), text, days);
+	}
+
+	size_t parseMany(const string_view *texts, size_t n, int32_t *days)
+	{
+#if defined(__SSE2__)
+		const int32_t *yearStart = yearStarts();
+		size_t valid = 0;
+		for (size_t i = 0; i < n; i++)
+		{
+			bool ok = parseSse2(yearStart, texts[i], days[i]);
+			if (!ok)
+			{
+				days[i] = INVALID;
+			}
+			valid += ok;
+		}
+		return valid;
+#else
+		return parseManyScalar(texts, n, days);
+#endif
+	}
+
+	size_t parseManyScalar(const string_view *texts, size_t n, int32_t *days)
+	{
+		const int32_t *yearStart = yearStarts();
+		size_t valid = 0;
+		for (size_t i = 0; i < n; i++)
+		{
+			bool ok = parseDigits(yearStart, texts[i], days[i]);
+			if (!ok)
+			{
+				days[i] = INVALID;
+			}
+			valid += ok;
+		}
+		return valid;
+	}
+
+	void format(int32_t days, char out[10])
+	{
+		int year, month, day;
+		toCivil(days, year, month, day);
+		out[0] = static_cast<char>('0' + day / 10);
+		out[1] = static_cast<char>('0' + day % 10);
+		out[2] = '/';
+		out[3] = static_cast<char>('0' + month / 10);
+		out[4] = static_cast<char>('0' + month % 10);
+		out[5] = '/';
+		out[6] = static_cast<char>('0' + year / 1000 % 10);
+		out[7] = static_cast<char>('0' + year / 100 % 10);
+		out[8] = static_cast<char>('0' + year / 10 % 10);
+		out[9] = static_cast<char>('0' + year % 10);
+	}
+
+	string format(int32_t days)
+	{
+		char out[10];
+		format(days, out);
+		return string(out, 10);
+	}
+
+	int yearOf(int32_t days)
+	{
+		int year, month, day;
+		toCivil(days, year, month, day);
+		return year;
+	}
+
+	bool isLeapYear(int year)
+	{
+		return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+	}
+}
@@ -0,0 +1,40 @@
+#ifndef BIRTHDATE_H
+#define BIRTHDATE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// Conversions between "dd/mm/yyyy" birth dates and day numbers (days since
+// 01/01/1970, negative before). Only the canonical ten-character form is
+// accepted so that formatting a parsed date reproduces the original text.
+namespace BirthDate
+{
+	// Day number stored for text that is not a valid dd/mm/yyyy date.
+	const int32_t INVALID = INT32_MIN;
+
+	int32_t fromCivil(int year, int month, int day);
+
+	void toCivil(int32_t days, int &year, int &month, int &day);
+
+	bool parse(std::string_view text, int32_t &days);
+
+	// Parses texts[0, n) into days, writing INVALID for rejected entries,
+	// and returns the number of valid dates. Uses SSE2 where available.
+	size_t parseMany(const std::string_view *texts, size_t n, int32_t *days);
+
+	// Portable version of parseMany(); same results.
+	size_t parseManyScalar(const std::string_view *texts, size_t n, int32_t *days);
+
+	// Writes exactly ten characters.
+	void format(int32_t days, char out[10]);
+
+	std::string format(int32_t days);
+
+	int yearOf(int32_t days);
+
+	bool isLeapYear(int year);
+}
+
+#endif // BIRTHDATE_H
@@ -0,0 +1,82 @@
+#include "BufferedWriter.h"
+#include <charconv>
+#include <cstring>
+
+using namespace std;
+
+BufferedWriter::BufferedWriter(ostream &out) : out(out), buffer(FLUSH_BYTES + 4096), used(0), bytesWritten(0)
+{
+}
+
+BufferedWriter::~BufferedWriter()
+{
+	flush();
+}
+
+void BufferedWriter::append(string_view text)
+{
+	if (used + text.size() > buffer.size())
+	{
+		write();
+		if (text.size() > buffer.size())
+		{
+			out.write(text.data(), static_cast<streamsize>(text.size()));
+			bytesWritten += text.size();
+			return;
+		}
+	}
+	memcpy(buffer.data() + used, text.data(), text.size());
+	used += text.size();
+}
+
+void BufferedWriter::append(char c)
+{
+	if (used == buffer.size())
+	{
+		write();
+	}
+	buffer[used++] = c;
+}
+
+void BufferedWriter::appendInt(long long value)
+{
+	char digits[24];
+	to_chars_result result = to_chars(digits, digits + sizeof(digits), value);
+	append(string_view(digits, result.ptr - digits));
+}
+
+void BufferedWriter::appendDouble(double value)
+{
+	char digits[32];
+	to_chars_result result = to_chars(digits, digits + sizeof(digits), value, chars_format::general, 6);
+	append(string_view(digits, result.ptr - digits));
+}
+
+void BufferedWriter::flushIfFull()
+{
+	if (used >= FLUSH_BYTES)
+	{
+		write();
+	}
+}
+
+void BufferedWriter::flush()
+{
+	write();
+	out.flush();
+}
+
+void BufferedWriter::write()
+{
+	if (used > 0)
+	{
+		out.write(buffer.data(), static_cast<streamsize>(used));
+		bytesWritten += used;
+		used = 0;
+	}
+}
+
+size_t BufferedWriter::getBytesWritten() const
+{
+	return bytesWritten;
+}
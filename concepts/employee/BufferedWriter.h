@@ -0,0 +1,51 @@
+#ifndef BUFFEREDWRITER_H
+#define BUFFEREDWRITER_H
+
+#include <cstddef>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+// Output buffer for bulk text: strings are copied and numbers formatted
+// with std::to_chars into a reusable buffer that reaches the stream in
+// FLUSH_BYTES chunks, instead of one operator<< call per field. Used by
+// the report, the payroll pipeline's CSV and the script runner.
+class BufferedWriter
+{
+public:
+	static const size_t FLUSH_BYTES = 64 * 1024;
+
+	explicit BufferedWriter(std::ostream &out);
+
+	~BufferedWriter();
+
+	BufferedWriter(const BufferedWriter &) = delete;
+	BufferedWriter &operator=(const BufferedWriter &) = delete;
+
+	void append(std::string_view text);
+
+	void append(char c);
+
+	void appendInt(long long value);
+
+	// Matches the default ostream formatting (%g, six significant digits).
+	void appendDouble(double value);
+
+	// Writes the buffer out once it holds FLUSH_BYTES; call between records.
+	void flushIfFull();
+
+	// Writes the buffer out and flushes the stream.
+	void flush();
+
+	size_t getBytesWritten() const;
+
+private:
+	void write();
+
+	std::ostream &out;
+	std::vector<char> buffer;
+	size_t used;
+	size_t bytesWritten;
+};
+
+#endif // BUFFEREDWRITER_H
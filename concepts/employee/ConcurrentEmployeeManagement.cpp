@@ -0,0 +1,190 @@
+#include "ConcurrentEmployeeManagement.h"
+#include "OfficeEmployee.h"
+#include "ReportRenderer.h"
+#include "Worker.h"
+#include <iostream>
+
+using namespace std;
+
+ConcurrentEmployeeManagement::ConcurrentEmployeeManagement() : shards(new Shard[SHARDS])
+{
+	for (size_t s = 0; s < SHARDS; s++)
+	{
+		shards[s].published.store(0, memory_order_relaxed);
+	}
+}
+
+size_t ConcurrentEmployeeManagement::capacityPerShard()
+{
+	return SEGMENT_ROWS * MAX_SEGMENTS;
+}
+
+size_t ConcurrentEmployeeManagement::writerShard()
+{
+	static atomic<size_t> nextShard(0);
+	thread_local size_t shard = nextShard.fetch_add(1, memory_order_relaxed) % SHARDS;
+	return shard;
+}
+
+bool ConcurrentEmployeeManagement::append(Shard &shard, size_t &n, const EmployeeRecord &record)
+{
+	size_t segment = n >> SEGMENT_BITS;
+	if (segment >= MAX_SEGMENTS)
+	{
+		return false;
+	}
+	// Readers only look at segments below the published count, so a new
+	// segment can be installed without synchronising with them.
+	if (!shard.segments[segment])
+	{
+		shard.segments[segment].reset(new Row[SEGMENT_ROWS]);
+	}
+
+	Row &row = shard.segments[segment][n & (SEGMENT_ROWS - 1)];
+	row.record = record;
+	row.officeUnits = 0;
+	row.workerUnits = 0;
+	if (n > 0)
+	{
+		const Row &previous = shard.segments[(n - 1) >> SEGMENT_BITS][(n - 1) & (SEGMENT_ROWS - 1)];
+		row.officeUnits = previous.officeUnits;
+		row.workerUnits = previous.workerUnits;
+	}
+	if (record.type == EmployeeType::Office)
+	{
+		row.officeUnits += record.units;
+	}
+	else
+	{
+		row.workerUnits += record.units;
+	}
+	n++;
+	return true;
+}
+
+bool ConcurrentEmployeeManagement::addRecord(const EmployeeRecord &record)
+{
+	Shard &shard = shards[writerShard()];
+	lock_guard<mutex> lock(shard.writeLock);
+	size_t n = shard.published.load(memory_order_relaxed);
+	if (!append(shard, n, record))
+	{
+		return false;
+	}
+	shard.published.store(n, memory_order_release);
+	return true;
+}
+
+bool ConcurrentEmployeeManagement::addEmployee(const Employee &e)
+{
+	return addRecord(EmployeeRecord::fromEmployee(e));
+}
+
+bool ConcurrentEmployeeManagement::addOfficeEmployee(string_view name, string_view birthDate, int workingDays)
+{
+	return addRecord(EmployeeRecord::make(EmployeeType::Office, name, birthDate, workingDays));
+}
+
+bool ConcurrentEmployeeManagement::addWorker(string_view name, string_view birthDate, int noOfProducts)
+{
+	return addRecord(EmployeeRecord::make(EmployeeType::Worker, name, birthDate, noOfProducts));
+}
+
+size_t ConcurrentEmployeeManagement::addBatch(const vector<RosterRow> &rows)
+{
+	Shard &shard = shards[writerShard()];
+	lock_guard<mutex> lock(shard.writeLock);
+	size_t first = shard.published.load(memory_order_relaxed);
+	size_t n = first;
+	for (const RosterRow &row : rows)
+	{
+		if (!append(shard, n, EmployeeRecord::make(row.type, row.name, row.birthDate, row.units)))
+		{
+			break;
+		}
+	}
+	shard.published.store(n, memory_order_release);
+	return n - first;
+}
+
+ConcurrentEmployeeManagement::Snapshot ConcurrentEmployeeManagement::snapshot() const
+{
+	Snapshot snapshot;
+	snapshot.roster = this;
+	for (size_t s = 0; s < SHARDS; s++)
+	{
+		snapshot.counts[s] = shards[s].published.load(memory_order_acquire);
+	}
+	return snapshot;
+}
+
+size_t ConcurrentEmployeeManagement::size() const
+{
+	return snapshot().size();
+}
+
+double ConcurrentEmployeeManagement::calculateTotalSalary() const
+{
+	return snapshot().totalSalary();
+}
+
+void ConcurrentEmployeeManagement::displayAll() const
+{
+	ReportRenderer(cout).renderAll(*this);
+}
+
+size_t ConcurrentEmployeeManagement::Snapshot::size() const
+{
+	size_t n = 0;
+	for (size_t s = 0; s < SHARDS; s++)
+	{
+		n += counts[s];
+	}
+	return n;
+}
+
+size_t ConcurrentEmployeeManagement::Snapshot::size(size_t shard) const
+{
+	return counts[shard];
+}
+
+const ConcurrentEmployeeManagement::Row *ConcurrentEmployeeManagement::Snapshot::last(size_t shard) const
+{
+	size_t n = counts[shard];
+	if (n == 0)
+	{
+		return nullptr;
+	}
+	return &roster->shards[shard].segments[(n - 1) >> SEGMENT_BITS][(n - 1) & (SEGMENT_ROWS - 1)];
+}
+
+double ConcurrentEmployeeManagement::Snapshot::totalSalary() const
+{
+	return totalSalary(EmployeeType::Office) + totalSalary(EmployeeType::Worker);
+}
+
+double ConcurrentEmployeeManagement::Snapshot::totalSalary(EmployeeType type) const
+{
+	int64_t units = 0;
+	for (size_t s = 0; s < SHARDS; s++)
+	{
+		const Row *row = last(s);
+		if (row)
+		{
+			units += type == EmployeeType::Office ? row->officeUnits : row->workerUnits;
+		}
+	}
+	int rate = type == EmployeeType::Office ? OfficeEmployee::DAILY_RATE : Worker::PRODUCT_RATE;
+	return static_cast<double>(units * rate);
+}
+
+const EmployeeRecord &ConcurrentEmployeeManagement::Snapshot::at(size_t i) const
+{
+	size_t s = 0;
+	while (i >= counts[s])
+	{
+		i -= counts[s];
+		s++;
+	}
+	return roster->shards[s].segments[i >> SEGMENT_BITS][i & (SEGMENT_ROWS - 1)].record;
+}
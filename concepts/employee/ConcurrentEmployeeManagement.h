@@ -0,0 +1,133 @@
+#ifndef CONCURRENTEMPLOYEEMANAGEMENT_H
+#define CONCURRENTEMPLOYEEMANAGEMENT_H
+
+#include "EmployeeRecord.h"
+#include "RosterLoader.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+// Roster backend that can be queried while it is being loaded.
+//
+// Employees are appended to one of SHARDS append-only shards, chosen per
+// writer thread, so concurrent loaders rarely share a lock; the shared
+// StringPool they intern names into is split into separately locked
+// stripes. Rows live in fixed segments that are never moved, and a row is
+// never changed once written. Each shard publishes how many of its rows
+// are complete with a single release store; a Snapshot is just those
+// counts. Taking a snapshot and querying it never locks, never waits on a
+// writer and never allocates, and a snapshot stays valid (and unchanged)
+// for the life of the manager.
+//
+// Every row also carries the running office/worker units of its shard up
+// to and including itself, so a snapshot's payroll is read off the last
+// visible row of each shard and always matches the rows it lists.
+class ConcurrentEmployeeManagement
+{
+	struct Row
+	{
+		EmployeeRecord record;
+		int64_t officeUnits;
+		int64_t workerUnits;
+	};
+
+public:
+	static const size_t SHARDS = 8;
+	static const size_t SEGMENT_BITS = 16;
+	static const size_t SEGMENT_ROWS = size_t(1) << SEGMENT_BITS;
+	static const size_t MAX_SEGMENTS = 4096;
+
+	// The roster as it was when snapshot() was called. Rows are ordered
+	// shard by shard, in insertion order within each shard.
+	class Snapshot
+	{
+	public:
+		size_t size() const;
+
+		size_t size(size_t shard) const;
+
+		double totalSalary() const;
+
+		double totalSalary(EmployeeType type) const;
+
+		const EmployeeRecord &at(size_t i) const;
+
+		// Calls f(record) for every row, in snapshot order.
+		template <typename F>
+		void forEach(F f) const
+		{
+			for (size_t s = 0; s < SHARDS; s++)
+			{
+				const Shard &shard = roster->shards[s];
+				for (size_t first = 0; first < counts[s]; first += SEGMENT_ROWS)
+				{
+					const Row *segment = shard.segments[first >> SEGMENT_BITS].get();
+					size_t n = counts[s] - first < SEGMENT_ROWS ? counts[s] - first : SEGMENT_ROWS;
+					for (size_t i = 0; i < n; i++)
+					{
+						f(segment[i].record);
+					}
+				}
+			}
+		}
+
+	private:
+		friend class ConcurrentEmployeeManagement;
+
+		const Row *last(size_t shard) const;
+
+		const ConcurrentEmployeeManagement *roster;
+		size_t counts[SHARDS];
+	};
+
+	ConcurrentEmployeeManagement();
+
+	ConcurrentEmployeeManagement(const ConcurrentEmployeeManagement &) = delete;
+	ConcurrentEmployeeManagement &operator=(const ConcurrentEmployeeManagement &) = delete;
+
+	// Writers. Safe to call from any number of threads at once; each
+	// returns false (or the rows added) once the writer's shard is full.
+	bool addEmployee(const Employee &e);
+
+	bool addOfficeEmployee(std::string_view name, std::string_view birthDate, int workingDays);
+
+	bool addWorker(std::string_view name, std::string_view birthDate, int noOfProducts);
+
+	// The whole batch becomes visible to readers at once.
+	size_t addBatch(const std::vector<RosterRow> &rows);
+
+	// Readers. Wait-free; safe to call concurrently with the writers.
+	Snapshot snapshot() const;
+
+	size_t size() const;
+
+	double calculateTotalSalary() const;
+
+	void displayAll() const;
+
+	static size_t capacityPerShard();
+
+private:
+	struct alignas(64) Shard
+	{
+		std::atomic<size_t> published;
+		std::mutex writeLock;
+		std::unique_ptr<Row[]> segments[MAX_SEGMENTS];
+	};
+
+	// The shard the calling thread appends to, assigned round-robin on its first write.
+	static size_t writerShard();
+
+	bool addRecord(const EmployeeRecord &record);
+
+	// Appends after the shard's last row without publishing it; needs writeLock.
+	static bool append(Shard &shard, size_t &n, const EmployeeRecord &record);
+
+	std::unique_ptr<Shard[]> shards;
+};
+
+#endif // CONCURRENTEMPLOYEEMANAGEMENT_H
@@ -0,0 +1,229 @@
+#include "DuplicateFilter.h"
+#include <functional>
+
+using namespace std;
+
+namespace
+{
+	// One odd multiplier per word of a block; the top five bits of
+	// key * SALT[i] pick the bit set in word i.
+	const uint32_t SALT[DuplicateFilter::BLOCK_WORDS] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+																											 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+}
+
+DuplicateFilter::DuplicateFilter(const EmployeeColumns &columns)
+		: columns(columns), keyCount(0), seenRows(0), lookups(0), duplicates(0), falsePositives(0)
+{
+}
+
+uint64_t DuplicateFilter::hashKey(string_view name, string_view birthDate)
+{
+	uint64_t h = hash<string_view>()(name) ^ (hash<string_view>()(birthDate) * 0x9e3779b97f4a7c15ULL);
+	// splitmix64 finalizer, so every bit depends on both fields
+	h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+	return h ^ (h >> 31);
+}
+
+// The high half picks the block (and is the set's tag), the low half the
+// bits within it.
+bool DuplicateFilter::mayContain(uint64_t h) const
+{
+	size_t blocks = filter.size() / BLOCK_WORDS;
+	const uint32_t *block = filter.data() + ((h >> 32) * blocks >> 32) * BLOCK_WORDS;
+	uint32_t key = static_cast<uint32_t>(h);
+	bool all = true;
+	for (size_t i = 0; i < BLOCK_WORDS; i++)
+	{
+		all &= (block[i] >> ((key * SALT[i]) >> 27) & 1) != 0;
+	}
+	return all;
+}
+
+void DuplicateFilter::addToFilter(uint64_t h)
+{
+	size_t blocks = filter.size() / BLOCK_WORDS;
+	uint32_t *block = filter.data() + ((h >> 32) * blocks >> 32) * BLOCK_WORDS;
+	uint32_t key = static_cast<uint32_t>(h);
+	for (size_t i = 0; i < BLOCK_WORDS; i++)
+	{
+		block[i] |= 1u << ((key * SALT[i]) >> 27);
+	}
+}
+
+void DuplicateFilter::reserve(size_t keys)
+{
+	size_t slotCount = 16;
+	while (slotCount < keys * 2)
+	{
+		slotCount *= 2;
+	}
+	if (slotCount > slots.size())
+	{
+		resize(slotCount);
+	}
+	catchUp();
+}
+
+void DuplicateFilter::resize(size_t slotCount)
+{
+	vector<Slot> old;
+	old.swap(slots);
+	slots.assign(slotCount, Slot{0, 0});
+	size_t mask = slotCount - 1;
+	for (const Slot &slot : old)
+	{
+		if (slot.row == 0)
+		{
+			continue;
+		}
+		size_t i = slot.tag & mask;
+		while (slots[i].row != 0)
+		{
+			i = (i + 1) & mask;
+		}
+		slots[i] = slot;
+	}
+
+	// Sized for the set's capacity of slotCount / 2 keys.
+	size_t blocks = slotCount / 2 * BITS_PER_KEY / (32 * BLOCK_WORDS);
+	filter.assign((blocks > 0 ? blocks : 1) * BLOCK_WORDS, 0);
+	for (const Slot &slot : slots)
+	{
+		if (slot.row != 0)
+		{
+			addToFilter(hashKey(columns.nameAt(slot.row - 1), columns.birthDateAt(slot.row - 1)));
+		}
+	}
+}
+
+bool DuplicateFilter::add(uint64_t h, string_view name, string_view birthDate, size_t row, bool count)
+{
+	if ((keyCount + 1) * 2 > slots.size())
+	{
+		resize(slots.empty() ? 16 : slots.size() * 2);
+	}
+	uint32_t tag = static_cast<uint32_t>(h >> 32);
+	size_t mask = slots.size() - 1;
+	size_t i = tag & mask;
+	if (mayContain(h))
+	{
+		for (; slots[i].row != 0; i = (i + 1) & mask)
+		{
+			const Slot &slot = slots[i];
+			if (slot.tag == tag && columns.nameAt(slot.row - 1) == name && columns.birthDateAt(slot.row - 1) == birthDate)
+			{
+				duplicates += count;
+				return false;
+			}
+		}
+		falsePositives += count;
+	}
+	else
+	{
+		// Certainly new: only an empty slot is needed.
+		while (slots[i].row != 0)
+		{
+			i = (i + 1) & mask;
+		}
+	}
+	slots[i] = Slot{tag, static_cast<uint32_t>(row + 1)};
+	keyCount++;
+	addToFilter(h);
+	return true;
+}
+
+void DuplicateFilter::catchUp()
+{
+	if (seenRows >= columns.size())
+	{
+		return;
+	}
+	if ((keyCount + columns.size() - seenRows) * 2 > slots.size())
+	{
+		reserve(keyCount + columns.size() - seenRows);
+		return; // reserve() caught up
+	}
+	for (size_t row = seenRows; row < columns.size(); row++)
+	{
+		string_view name = columns.nameAt(row);
+		string_view birthDate = columns.birthDateAt(row);
+		add(hashKey(name, birthDate), name, birthDate, row, false);
+	}
+	seenRows = columns.size();
+}
+
+bool DuplicateFilter::insert(string_view name, string_view birthDate)
+{
+	return insert(hashKey(name, birthDate), name, birthDate);
+}
+
+bool DuplicateFilter::insert(uint64_t h, string_view name, string_view birthDate)
+{
+	catchUp();
+	lookups++;
+	if (!add(h, name, birthDate, columns.size(), true))
+	{
+		return false;
+	}
+	seenRows = columns.size() + 1;
+	return true;
+}
+
+void DuplicateFilter::prefetch(uint64_t h) const
+{
+	if (slots.empty())
+	{
+		return;
+	}
+	size_t blocks = filter.size() / BLOCK_WORDS;
+	__builtin_prefetch(filter.data() + ((h >> 32) * blocks >> 32) * BLOCK_WORDS);
+	__builtin_prefetch(slots.data() + ((h >> 32) & (slots.size() - 1)));
+}
+
+void DuplicateFilter::clear()
+{
+	filter.clear();
+	slots.clear();
+	keyCount = 0;
+	seenRows = 0;
+	lookups = 0;
+	duplicates = 0;
+	falsePositives = 0;
+}
+
+size_t DuplicateFilter::keys() const
+{
+	return keyCount;
+}
+
+size_t DuplicateFilter::getLookups() const
+{
+	return lookups;
+}
+
+size_t DuplicateFilter::getDuplicates() const
+{
+	return duplicates;
+}
+
+size_t DuplicateFilter::getFalsePositives() const
+{
+	return falsePositives;
+}
+
+double DuplicateFilter::falsePositiveRate() const
+{
+	size_t newKeys = lookups - duplicates;
+	return newKeys == 0 ? 0.0 : static_cast<double>(falsePositives) / newKeys;
+}
+
+size_t DuplicateFilter::filterBytes() const
+{
+	return filter.capacity() * sizeof(uint32_t);
+}
+
+size_t DuplicateFilter::setBytes() const
+{
+	return slots.capacity() * sizeof(Slot);
+}
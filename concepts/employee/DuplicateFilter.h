@@ -0,0 +1,100 @@
+#ifndef DUPLICATEFILTER_H
+#define DUPLICATEFILTER_H
+
+#include "EmployeeColumns.h"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// Detects employees already on the roster, keyed on (name, birth date),
+// so a bulk import can drop repeated people.
+//
+// The exact answer comes from an open-addressing hash set whose slots hold
+// a 32-bit hash tag and a row number; keys are compared against the column
+// heaps, so no string is copied. In front of it sits a blocked Bloom
+// filter: each key sets one bit in each of the eight 32-bit words of a
+// single 32-byte block, so a query costs one cache line. Most imported
+// rows are new, the filter says so, and they are inserted into the set
+// without comparing any key. Only filter hits are looked up in full; the
+// hits that turn out to be new are the false positives.
+//
+// The set grows by doubling and rehashes from its stored tags alone. The
+// filter has to be rebuilt from the keys when it grows, so reserve() both
+// up front for large loads.
+//
+// Each lookup misses the cache twice, once in the filter and once in the
+// set. A bulk caller hashes a batch with hashKey() and calls prefetch() a
+// few rows ahead of insert(), so those misses overlap.
+class DuplicateFilter
+{
+public:
+	static constexpr size_t BLOCK_WORDS = 8;
+	static constexpr size_t BITS_PER_KEY = 16;
+
+	explicit DuplicateFilter(const EmployeeColumns &columns);
+
+	DuplicateFilter(const DuplicateFilter &) = delete;
+	DuplicateFilter &operator=(const DuplicateFilter &) = delete;
+
+	// Sizes the set and the filter for keys distinct employees, then records
+	// any rows appended without insert(), so neither happens mid-load.
+	void reserve(size_t keys);
+
+	// Checks the employee about to be appended to the columns. Returns false
+	// if an earlier row has the same name and birth date. Otherwise records
+	// the key as row columns.size(), which the caller must append next.
+	// Rows appended since the last call are recorded first.
+	bool insert(std::string_view name, std::string_view birthDate);
+
+	// As above, with h = hashKey(name, birthDate).
+	bool insert(uint64_t h, std::string_view name, std::string_view birthDate);
+
+	// Starts loading the filter block and set slot insert(h, ...) will read.
+	void prefetch(uint64_t h) const;
+
+	static uint64_t hashKey(std::string_view name, std::string_view birthDate);
+
+	void clear();
+
+	size_t keys() const;
+
+	// Counters over insert() calls.
+	size_t getLookups() const;
+	size_t getDuplicates() const;
+	size_t getFalsePositives() const;
+
+	// Share of new keys the filter wrongly reported as possibly present.
+	double falsePositiveRate() const;
+
+	size_t filterBytes() const;
+	size_t setBytes() const;
+
+private:
+	struct Slot
+	{
+		uint32_t tag;
+		uint32_t row; // row + 1, 0 when empty
+	};
+
+	bool mayContain(uint64_t h) const;
+	void addToFilter(uint64_t h);
+
+	// Records row unless its key is present; returns false if it was.
+	// count updates the insert() counters.
+	bool add(uint64_t h, std::string_view name, std::string_view birthDate, size_t row, bool count);
+
+	void catchUp();
+	void resize(size_t slotCount);
+
+	const EmployeeColumns &columns;
+	std::vector<uint32_t> filter; // BLOCK_WORDS words per block
+	std::vector<Slot> slots;
+	size_t keyCount;
+	size_t seenRows;
+	size_t lookups;
+	size_t duplicates;
+	size_t falsePositives;
+};
+
+#endif // DUPLICATEFILTER_H
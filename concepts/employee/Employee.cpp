@@ -5,41 +5,56 @@
 using namespace std;
 
 Employee::Employee()
-		: name("UNKNOWN"),
-			birthDate("01/01/1990"),
+		: nameId(StringPool::shared().intern("UNKNOWN")),
+			birthDateId(StringPool::shared().intern("01/01/1990")),
 			salary(0)
 {
 }
 
-Employee::Employee(const std::string& name,
-									 const std::string& birthDate)
-		: name(name), birthDate(birthDate), salary(0)
+Employee::Employee(std::string_view name,
+									 std::string_view birthDate)
+		: nameId(StringPool::shared().intern(name)),
+			birthDateId(StringPool::shared().intern(birthDate)),
+			salary(0)
 {
 }
 
 Employee::~Employee() {}
 
-string Employee::getName() const
+string_view Employee::getName() const
+{
+	return StringPool::shared().view(nameId);
+}
+
+string_view Employee::getBirthDate() const
+{
+	return StringPool::shared().view(birthDateId);
+}
+
+uint32_t Employee::getNameId() const
 {
-	return name;
+	return nameId;
 }
 
-string Employee::getBirthDate() const
+uint32_t Employee::getBirthDateId() const
 {
-	return birthDate;
+	return birthDateId;
 }
 
-void Employee::describe()
+void Employee::describe() const
 {
-	cout << "  | Name:        " << name << "\n";
-	cout << "  | Birth Date:  " << birthDate << "\n";
+	cout << "  | Name:        " << getName() << "\n";
+	cout << "  | Birth Date:  " << getBirthDate() << "\n";
 	cout << "  | Salary:      $" << calculateSalary() << "\n";
 }
 
 void Employee::enterInfo()
 {
+	string line;
 	cout << "  Enter Name:        ";
-	getline(cin, name);
+	getline(cin, line);
+	nameId = StringPool::shared().intern(line);
 	cout << "  Enter Birth Date:  ";
-	getline(cin, birthDate);
+	getline(cin, line);
+	birthDateId = StringPool::shared().intern(line);
 }
\ No newline at end of file
@@ -1,29 +1,44 @@
 #ifndef EMPLOYEE_H
 #define EMPLOYEE_H
 
+#include "StringPool.h"
+#include <cstdint>
 #include <string>
+#include <string_view>
+
+enum class EmployeeType : unsigned char
+{
+	Office = 1,
+	Worker = 2
+};
 
 class Employee
 {
 public:
 	Employee();
 
-	Employee(const std::string& name, const std::string& birthDate);
+	Employee(std::string_view name, std::string_view birthDate);
 
 	virtual ~Employee();
 
-	std::string getName() const;
-	std::string getBirthDate() const;
+	// Views into StringPool::shared(); valid for the life of the process.
+	std::string_view getName() const;
+	std::string_view getBirthDate() const;
+
+	uint32_t getNameId() const;
+	uint32_t getBirthDateId() const;
+
+	virtual EmployeeType getType() const = 0;
 
 	virtual void enterInfo();
 
-	virtual double calculateSalary() = 0;
+	virtual double calculateSalary() const = 0;
 
-	virtual void describe();
+	virtual void describe() const;
 
 protected:
-	std::string name;
-	std::string birthDate;
+	uint32_t nameId;
+	uint32_t birthDateId;
 	double salary;
 };
 
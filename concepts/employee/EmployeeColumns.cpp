@@ -0,0 +1,236 @@
+#include "EmployeeColumns.h"
+#include "BirthDate.h"
+#include "OfficeEmployee.h"
+#include "Worker.h"
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+EmployeeColumns::EmployeeColumns() {}
+
+void EmployeeColumns::reserve(size_t n)
+{
+	typeColumn.reserve(n);
+	unitColumn.reserve(n);
+	nameColumn.reserve(n);
+	birthDateColumn.reserve(n);
+	birthDayColumn.reserve(n);
+}
+
+void EmployeeColumns::clear()
+{
+	typeColumn.clear();
+	unitColumn.clear();
+	nameColumn.clear();
+	birthDateColumn.clear();
+	birthDayColumn.clear();
+}
+
+size_t EmployeeColumns::size() const
+{
+	return typeColumn.size();
+}
+
+bool EmployeeColumns::empty() const
+{
+	return typeColumn.empty();
+}
+
+void EmployeeColumns::add(EmployeeType type, string_view name, string_view birthDate, int units)
+{
+	StringPool &pool = StringPool::shared();
+	add(type, pool.intern(name), pool.intern(birthDate), units);
+}
+
+void EmployeeColumns::add(EmployeeType type, uint32_t nameId, uint32_t birthDateId, int units)
+{
+	typeColumn.push_back(type);
+	unitColumn.push_back(units);
+	nameColumn.push_back(nameId);
+	birthDateColumn.push_back(birthDateId);
+}
+
+void EmployeeColumns::setUnits(size_t i, int units)
+{
+	unitColumn[i] = units;
+}
+
+EmployeeType EmployeeColumns::typeAt(size_t i) const
+{
+	return typeColumn[i];
+}
+
+int EmployeeColumns::unitsAt(size_t i) const
+{
+	return unitColumn[i];
+}
+
+string_view EmployeeColumns::nameAt(size_t i) const
+{
+	return StringPool::shared().view(nameColumn[i]);
+}
+
+string_view EmployeeColumns::birthDateAt(size_t i) const
+{
+	return StringPool::shared().view(birthDateColumn[i]);
+}
+
+uint32_t EmployeeColumns::nameIdAt(size_t i) const
+{
+	return nameColumn[i];
+}
+
+uint32_t EmployeeColumns::birthDateIdAt(size_t i) const
+{
+	return birthDateColumn[i];
+}
+
+double EmployeeColumns::salaryAt(size_t i) const
+{
+	int rate = typeColumn[i] == EmployeeType::Office ? OfficeEmployee::DAILY_RATE : Worker::PRODUCT_RATE;
+	return static_cast<double>(unitColumn[i]) * rate;
+}
+
+double EmployeeColumns::calculateTotalSalary() const
+{
+	return static_cast<double>(sumSalary(0, size()));
+}
+
+int64_t EmployeeColumns::sumSalary(size_t first, size_t last) const
+{
+	// Accumulate units per type in 64-bit integers and apply the rates once
+	// at the end. The loop has no branches and no floating-point adds, so
+	// it vectorizes and the result does not depend on summation order.
+	const EmployeeType *type = typeColumn.data();
+	const int32_t *units = unitColumn.data();
+	int64_t officeUnits = 0;
+	int64_t workerUnits = 0;
+	for (size_t i = first; i < last; i++)
+	{
+		int64_t u = units[i];
+		int64_t isOffice = type[i] == EmployeeType::Office;
+		officeUnits += u * isOffice;
+		workerUnits += u * (1 - isOffice);
+	}
+	return officeUnits * OfficeEmployee::DAILY_RATE + workerUnits * Worker::PRODUCT_RATE;
+}
+
+void EmployeeColumns::parseBirthDays()
+{
+	const size_t CHUNK = 256;
+	StringPool &pool = StringPool::shared();
+	string_view texts[CHUNK];
+	size_t first = birthDayColumn.size();
+	birthDayColumn.resize(birthDateColumn.size());
+	for (size_t i = first; i < birthDateColumn.size(); i += CHUNK)
+	{
+		size_t n = min(CHUNK, birthDateColumn.size() - i);
+		for (size_t k = 0; k < n; k++)
+		{
+			texts[k] = pool.view(birthDateColumn[i + k]);
+		}
+		BirthDate::parseMany(texts, n, birthDayColumn.data() + i);
+	}
+}
+
+int32_t EmployeeColumns::birthDayAt(size_t i) const
+{
+	return birthDayColumn[i];
+}
+
+size_t EmployeeColumns::parsedBirthDays() const
+{
+	return birthDayColumn.size();
+}
+
+void EmployeeColumns::selectBornBetween(int32_t firstDay, int32_t lastDay, vector<size_t> &out) const
+{
+	select(firstDay, lastDay, true, EmployeeType::Office, out);
+}
+
+void EmployeeColumns::selectBornBetween(int32_t firstDay, int32_t lastDay, EmployeeType type, vector<size_t> &out) const
+{
+	select(firstDay, lastDay, false, type, out);
+}
+
+void EmployeeColumns::select(int32_t firstDay, int32_t lastDay, bool anyType, EmployeeType type, vector<size_t> &out) const
+{
+	if (firstDay > lastDay)
+	{
+		return;
+	}
+	// firstDay <= day <= lastDay as one unsigned compare of day - firstDay.
+	// INVALID lands far outside any range of real birth dates.
+	uint32_t span = static_cast<uint32_t>(lastDay) - static_cast<uint32_t>(firstDay);
+	const int32_t *days = birthDayColumn.data();
+	const EmployeeType *types = typeColumn.data();
+	size_t n = birthDayColumn.size();
+	size_t i = 0;
+
+#if defined(__SSE2__)
+	// Four rows per step; SSE2 has no unsigned compare, so both sides are
+	// shifted by the sign bit and compared signed.
+	const __m128i sign = _mm_set1_epi32(INT32_MIN);
+	const __m128i base = _mm_set1_epi32(firstDay);
+	const __m128i limit = _mm_xor_si128(_mm_set1_epi32(static_cast<int32_t>(span)), sign);
+	const __m128i wanted = _mm_set1_epi32(static_cast<int32_t>(type));
+	const __m128i zero = _mm_setzero_si128();
+	for (; i + 4 <= n; i += 4)
+	{
+		__m128i day = _mm_loadu_si128(reinterpret_cast<const __m128i *>(days + i));
+		__m128i offset = _mm_xor_si128(_mm_sub_epi32(day, base), sign);
+		__m128i hit = _mm_andnot_si128(_mm_cmpgt_epi32(offset, limit), _mm_set1_epi32(-1));
+		if (!anyType)
+		{
+			int32_t packed;
+			memcpy(&packed, types + i, sizeof(packed));
+			__m128i t = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(packed), zero), zero);
+			hit = _mm_and_si128(hit, _mm_cmpeq_epi32(t, wanted));
+		}
+		int mask = _mm_movemask_ps(_mm_castsi128_ps(hit));
+		while (mask != 0)
+		{
+			out.push_back(i + __builtin_ctz(mask));
+			mask &= mask - 1;
+		}
+	}
+#endif
+
+	for (; i < n; i++)
+	{
+		bool inRange = static_cast<uint32_t>(days[i]) - static_cast<uint32_t>(firstDay) <= span;
+		if (inRange && (anyType || types[i] == type))
+		{
+			out.push_back(i);
+		}
+	}
+}
+
+size_t EmployeeColumns::bytesReserved() const
+{
+	return typeColumn.capacity() * sizeof(EmployeeType) +
+				 unitColumn.capacity() * sizeof(int32_t) +
+				 nameColumn.capacity() * sizeof(uint32_t) +
+				 birthDateColumn.capacity() * sizeof(uint32_t) +
+				 birthDayColumn.capacity() * sizeof(int32_t);
+}
+
+const EmployeeType *EmployeeColumns::types() const
+{
+	return typeColumn.data();
+}
+
+const int32_t *EmployeeColumns::units() const
+{
+	return unitColumn.data();
+}
+
+const int32_t *EmployeeColumns::birthDays() const
+{
+	return birthDayColumn.data();
+}
@@ -0,0 +1,83 @@
+#ifndef EMPLOYEECOLUMNS_H
+#define EMPLOYEECOLUMNS_H
+
+#include "Employee.h"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// Struct-of-arrays copy of the roster. Each field lives in its own
+// contiguous array so payroll scans touch only the bytes they need.
+// "units" is workingDays for office employees and noOfProducts for workers.
+class EmployeeColumns
+{
+public:
+	EmployeeColumns();
+
+	void reserve(size_t n);
+
+	void clear();
+
+	size_t size() const;
+
+	bool empty() const;
+
+	void add(EmployeeType type, std::string_view name, std::string_view birthDate, int units);
+
+	// Ids are StringPool::shared() ids, e.g. from Employee::getNameId().
+	void add(EmployeeType type, uint32_t nameId, uint32_t birthDateId, int units);
+
+	void setUnits(size_t i, int units);
+
+	EmployeeType typeAt(size_t i) const;
+	int unitsAt(size_t i) const;
+	std::string_view nameAt(size_t i) const;
+	std::string_view birthDateAt(size_t i) const;
+	uint32_t nameIdAt(size_t i) const;
+	uint32_t birthDateIdAt(size_t i) const;
+
+	double salaryAt(size_t i) const;
+
+	double calculateTotalSalary() const;
+
+	// Exact payroll of rows [first, last) in whole currency units.
+	int64_t sumSalary(size_t first, size_t last) const;
+
+	// Converts the birth dates of rows added since the last call into day
+	// numbers (BirthDate::INVALID when not dd/mm/yyyy). Birth dates never
+	// change, so only the new tail of the column is parsed.
+	void parseBirthDays();
+
+	// Valid only for rows covered by parseBirthDays().
+	int32_t birthDayAt(size_t i) const;
+
+	// Rows covered by parseBirthDays(); birthDays() has this many entries.
+	size_t parsedBirthDays() const;
+
+	// Appends rows born in [firstDay, lastDay] to out, in roster order.
+	void selectBornBetween(int32_t firstDay, int32_t lastDay, std::vector<size_t> &out) const;
+
+	void selectBornBetween(int32_t firstDay, int32_t lastDay, EmployeeType type, std::vector<size_t> &out) const;
+
+	size_t bytesReserved() const;
+
+	const EmployeeType *types() const;
+	const int32_t *units() const;
+	const int32_t *birthDays() const;
+
+private:
+	std::vector<EmployeeType> typeColumn;
+	std::vector<int32_t> unitColumn;
+
+	// Names and birth dates are interned; equal strings share one copy.
+	std::vector<uint32_t> nameColumn;
+	std::vector<uint32_t> birthDateColumn;
+
+	// Filled lazily by parseBirthDays(); may be shorter than the roster.
+	std::vector<int32_t> birthDayColumn;
+
+	void select(int32_t firstDay, int32_t lastDay, bool anyType, EmployeeType type, std::vector<size_t> &out) const;
+};
+
+#endif // EMPLOYEECOLUMNS_H
@@ -0,0 +1,192 @@
+#include "EmployeeIndex.h"
+#include <algorithm>
+#include <functional>
+
+using namespace std;
+
+namespace
+{
+	uint32_t hashKey(string_view key)
+	{
+		size_t h = hash<string_view>()(key);
+		return static_cast<uint32_t>(h ^ (h >> 32));
+	}
+
+	struct NameOrder
+	{
+		const EmployeeColumns &columns;
+
+		bool operator()(uint32_t a, uint32_t b) const
+		{
+			string_view na = columns.nameAt(a);
+			string_view nb = columns.nameAt(b);
+			return na < nb || (na == nb && a < b);
+		}
+	};
+}
+
+EmployeeIndex::HashIndex::HashIndex(const EmployeeColumns &columns, Field field)
+		: columns(columns), field(field), slots(16, Slot{0, 0}), keys(0)
+{
+}
+
+void EmployeeIndex::HashIndex::add(size_t row)
+{
+	if ((keys + 1) * 2 > slots.size())
+	{
+		grow();
+	}
+	if (next.size() <= row)
+	{
+		next.resize(row + 1, 0);
+	}
+
+	string_view key = (columns.*field)(row);
+	uint32_t h = hashKey(key);
+	size_t mask = slots.size() - 1;
+	for (size_t i = h & mask;; i = (i + 1) & mask)
+	{
+		Slot &slot = slots[i];
+		if (slot.head == 0)
+		{
+			slot.hash = h;
+			slot.head = static_cast<uint32_t>(row + 1);
+			keys++;
+			return;
+		}
+		if (slot.hash == h && (columns.*field)(slot.head - 1) == key)
+		{
+			next[row] = slot.head;
+			slot.head = static_cast<uint32_t>(row + 1);
+			return;
+		}
+	}
+}
+
+void EmployeeIndex::HashIndex::clear()
+{
+	slots.assign(16, Slot{0, 0});
+	next.clear();
+	keys = 0;
+}
+
+vector<size_t> EmployeeIndex::HashIndex::find(string_view key) const
+{
+	vector<size_t> rows;
+	uint32_t h = hashKey(key);
+	size_t mask = slots.size() - 1;
+	for (size_t i = h & mask; slots[i].head != 0; i = (i + 1) & mask)
+	{
+		const Slot &slot = slots[i];
+		if (slot.hash == h && (columns.*field)(slot.head - 1) == key)
+		{
+			for (uint32_t r = slot.head; r != 0; r = next[r - 1])
+			{
+				rows.push_back(r - 1);
+			}
+			reverse(rows.begin(), rows.end());
+			break;
+		}
+	}
+	return rows;
+}
+
+void EmployeeIndex::HashIndex::grow()
+{
+	vector<Slot> old;
+	old.swap(slots);
+	slots.assign(old.size() * 2, Slot{0, 0});
+	size_t mask = slots.size() - 1;
+	for (const Slot &slot : old)
+	{
+		if (slot.head == 0)
+		{
+			continue;
+		}
+		size_t i = slot.hash & mask;
+		while (slots[i].head != 0)
+		{
+			i = (i + 1) & mask;
+		}
+		slots[i] = slot;
+	}
+}
+
+EmployeeIndex::EmployeeIndex(const EmployeeColumns &columns)
+		: columns(columns),
+			nameIndex(columns, &EmployeeColumns::nameAt),
+			birthDateIndex(columns, &EmployeeColumns::birthDateAt)
+{
+}
+
+void EmployeeIndex::add(size_t row)
+{
+	nameIndex.add(row);
+	birthDateIndex.add(row);
+	pending.push_back(static_cast<uint32_t>(row));
+}
+
+void EmployeeIndex::clear()
+{
+	nameIndex.clear();
+	birthDateIndex.clear();
+	sortedByName.clear();
+	pending.clear();
+}
+
+vector<size_t> EmployeeIndex::findByName(string_view name) const
+{
+	return nameIndex.find(name);
+}
+
+vector<size_t> EmployeeIndex::findByBirthDate(string_view birthDate) const
+{
+	return birthDateIndex.find(birthDate);
+}
+
+vector<size_t> EmployeeIndex::findByNamePrefix(string_view prefix, size_t limit)
+{
+	if (pending.size() > 1024)
+	{
+		mergePending();
+	}
+
+	NameOrder byName{columns};
+	auto startsWith = [&prefix](string_view name) { return name.substr(0, prefix.size()) == prefix; };
+
+	vector<uint32_t> hits;
+	auto nameBefore = [this](uint32_t row, string_view key) { return columns.nameAt(row) < key; };
+	auto it = lower_bound(sortedByName.begin(), sortedByName.end(), prefix, nameBefore);
+	for (; it != sortedByName.end() && hits.size() < limit && startsWith(columns.nameAt(*it)); ++it)
+	{
+		hits.push_back(*it);
+	}
+	size_t fromSorted = hits.size();
+	for (uint32_t row : pending)
+	{
+		if (startsWith(columns.nameAt(row)))
+		{
+			hits.push_back(row);
+		}
+	}
+	if (hits.size() > fromSorted)
+	{
+		sort(hits.begin() + fromSorted, hits.end(), byName);
+		inplace_merge(hits.begin(), hits.begin() + fromSorted, hits.end(), byName);
+	}
+	if (hits.size() > limit)
+	{
+		hits.resize(limit);
+	}
+	return vector<size_t>(hits.begin(), hits.end());
+}
+
+void EmployeeIndex::mergePending()
+{
+	NameOrder byName{columns};
+	sort(pending.begin(), pending.end(), byName);
+	size_t middle = sortedByName.size();
+	sortedByName.insert(sortedByName.end(), pending.begin(), pending.end());
+	inplace_merge(sortedByName.begin(), sortedByName.begin() + middle, sortedByName.end(), byName);
+	pending.clear();
+}
@@ -0,0 +1,75 @@
+#ifndef EMPLOYEEINDEX_H
+#define EMPLOYEEINDEX_H
+
+#include "EmployeeColumns.h"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// Lookup indexes over the rows of an EmployeeColumns.
+//
+// Name and birth date each get an open-addressing hash table whose slots
+// hold row numbers, so keys are compared against the column heaps and no
+// string is copied. Rows sharing a key are chained through a per-row
+// "next" array. Name prefixes are answered from a name-sorted row
+// permutation; recent rows wait in a small unsorted tail that is merged
+// in once it holds more than a thousand rows.
+class EmployeeIndex
+{
+public:
+	explicit EmployeeIndex(const EmployeeColumns &columns);
+
+	EmployeeIndex(const EmployeeIndex &) = delete;
+	EmployeeIndex &operator=(const EmployeeIndex &) = delete;
+
+	// Indexes the row just appended to the columns.
+	void add(size_t row);
+
+	void clear();
+
+	// Matching rows in ascending order.
+	std::vector<size_t> findByName(std::string_view name) const;
+	std::vector<size_t> findByBirthDate(std::string_view birthDate) const;
+
+	// Up to limit rows whose name starts with prefix, ordered by name.
+	std::vector<size_t> findByNamePrefix(std::string_view prefix, size_t limit);
+
+private:
+	typedef std::string_view (EmployeeColumns::*Field)(size_t) const;
+
+	class HashIndex
+	{
+	public:
+		HashIndex(const EmployeeColumns &columns, Field field);
+
+		void add(size_t row);
+		void clear();
+		std::vector<size_t> find(std::string_view key) const;
+
+	private:
+		struct Slot
+		{
+			uint32_t hash;
+			uint32_t head; // newest row with this key + 1, 0 when empty
+		};
+
+		void grow();
+
+		const EmployeeColumns &columns;
+		Field field;
+		std::vector<Slot> slots;
+		std::vector<uint32_t> next; // per row: older row with the same key + 1
+		size_t keys;
+	};
+
+	void mergePending();
+
+	const EmployeeColumns &columns;
+	HashIndex nameIndex;
+	HashIndex birthDateIndex;
+	std::vector<uint32_t> sortedByName;
+	std::vector<uint32_t> pending;
+};
+
+#endif // EMPLOYEEINDEX_H
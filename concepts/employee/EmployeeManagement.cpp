@@ -1,8 +1,31 @@
+#ifndef EMPLOYEEMANAGEMENT_CPP
+#define EMPLOYEEMANAGEMENT_CPP
+
+#include <cstdlib>
 #include <iostream>
+#include <memory>
 #include <vector>
 #include <string>
+#include "BirthDate.h"
+#include "DuplicateFilter.h"
 #include "Employee.h"
+#include "EmployeeColumns.h"
+#include "EmployeeIndex.h"
+#include "EmployeeRecord.h"
+#include "Instrumentation.h"
 #include "OfficeEmployee.h"
+#include "ParallelPayroll.h"
+#include "PayPolicy.h"
+#include "PayrollAggregation.h"
+#include "PayrollHistory.h"
+#include "PayrollScenarios.h"
+#include "PayrollTotals.h"
+#include "ReportRenderer.h"
+#include "RosterJournal.h"
+#include "RosterLoader.h"
+#include "RosterOrder.h"
+#include "RosterSnapshot.h"
+#include "SlabPool.h"
 #include "Worker.h"
 using namespace std;
 
@@ -10,27 +33,366 @@ class EmployeeManagement
 {
 private:
 	vector<Employee *> employeeList;
+	EmployeeColumns columns;
+	EmployeeIndex index;
+
+	// (name, birth date) of every employee. Every add checks it; rows
+	// restored from a snapshot or journal are already unique and are
+	// recorded on the next add.
+	DuplicateFilter duplicates;
+
+	// Sorted views, cached until the next mutation.
+	RosterOrder order;
+
+	// Every employee lives in these pools. Callers only ever get const
+	// pointers, so units change through setWorkingDays()/setNoOfProducts()
+	// and the columns, totals, order and journal stay in sync.
+	SlabPool<OfficeEmployee> officePool;
+	SlabPool<Worker> workerPool;
+
+	// Maintained on every mutation so payroll queries are O(1).
+	PayrollTotals totals;
+
+	// Units of every closed payroll period, compressed.
+	PayrollHistory history;
+
+	// Write-ahead log of every mutation, when openJournal() attached one.
+	// Declared last so it is flushed before anything else is torn down.
+	unique_ptr<RosterJournal> journal;
+
+	static int unitsOf(const Employee *e)
+	{
+		if (e->getType() == EmployeeType::Office)
+		{
+			return static_cast<const OfficeEmployee *>(e)->getWorkingDays();
+		}
+		return static_cast<const Worker *>(e)->getNoOfProducts();
+	}
+
+	void track(Employee *e)
+	{
+		track(e, e->getType(), unitsOf(e));
+	}
+
+	void track(Employee *e, EmployeeType type, int units)
+	{
+		employeeList.push_back(e);
+		columns.add(type, e->getNameId(), e->getBirthDateId(), units);
+		size_t row = columns.size() - 1;
+		index.add(row);
+		order.rowAdded();
+		totals.add(type, units);
+		if (journal)
+		{
+			journal->logAdd(row, type, columns.nameAt(row), columns.birthDateAt(row), units);
+			compactIfDue();
+		}
+	}
+
+	void setUnits(size_t i, int units)
+	{
+		totals.update(columns.typeAt(i), columns.unitsAt(i), units);
+		columns.setUnits(i, units);
+		order.unitsChanged();
+		if (journal)
+		{
+			journal->logSetUnits(i, units);
+			compactIfDue();
+		}
+	}
+
+	void compactIfDue()
+	{
+		if (journal->compactionDue())
+		{
+			journal->compact();
+		}
+	}
+
+	// Restores a snapshot unchecked; only for an empty roster, whose
+	// snapshot already holds each employee once. See addRows().
+	void appendRows(const RosterSnapshot &snapshot)
+	{
+		size_t n = snapshot.size();
+		reserveMore(n);
+		for (size_t i = 0; i < n; i++)
+		{
+			appendRow(snapshot.typeAt(i), snapshot.nameAt(i), snapshot.birthDateAt(i), snapshot.unitsAt(i));
+		}
+	}
+
+	// As appendRows(), but drops anyone already on the roster, like
+	// addBatch(). Returns the rows added.
+	size_t addRows(const RosterSnapshot &snapshot)
+	{
+		const size_t prefetchDistance = 8;
+		size_t n = snapshot.size();
+		reserveMore(n);
+		duplicates.reserve(size() + n);
+		uint64_t keys[prefetchDistance];
+		for (size_t i = 0; i < n && i < prefetchDistance; i++)
+		{
+			keys[i] = DuplicateFilter::hashKey(snapshot.nameAt(i), snapshot.birthDateAt(i));
+			duplicates.prefetch(keys[i]);
+		}
+		size_t added = 0;
+		for (size_t i = 0; i < n; i++)
+		{
+			uint64_t h = keys[i % prefetchDistance];
+			size_t ahead = i + prefetchDistance;
+			if (ahead < n)
+			{
+				keys[i % prefetchDistance] = DuplicateFilter::hashKey(snapshot.nameAt(ahead), snapshot.birthDateAt(ahead));
+				duplicates.prefetch(keys[i % prefetchDistance]);
+			}
+			string_view name = snapshot.nameAt(i);
+			string_view birthDate = snapshot.birthDateAt(i);
+			if (duplicates.insert(h, name, birthDate))
+			{
+				appendRow(snapshot.typeAt(i), name, birthDate, snapshot.unitsAt(i));
+				added++;
+			}
+		}
+		return added;
+	}
+
+	void appendRow(EmployeeType type, string_view name, string_view birthDate, int units)
+	{
+		Employee *e;
+		if (type == EmployeeType::Office)
+		{
+			e = officePool.create(name, birthDate, units);
+		}
+		else
+		{
+			e = workerPool.create(name, birthDate, units);
+		}
+		track(e, type, units);
+	}
+
+	void checkTotals()
+	{
+#ifdef EMPLOYEE_DEBUG_TOTALS
+		double recomputed = recomputeTotalSalary();
+		if (recomputed != totals.totalSalary() || recomputed != columns.calculateTotalSalary())
+		{
+			cerr << "[!] Cached payroll " << totals.totalSalary()
+					 << " does not match recomputed " << recomputed << "\n";
+			abort();
+		}
+#endif
+	}
+
+	void reserveMore(size_t extra)
+	{
+		size_t needed = employeeList.size() + extra;
+		if (needed > employeeList.capacity())
+		{
+			size_t target = max(needed, employeeList.capacity() * 2);
+			employeeList.reserve(target);
+			columns.reserve(target);
+		}
+	}
 
 public:
-	EmployeeManagement()
+	EmployeeManagement() : index(columns), duplicates(columns), order(columns)
 	{
 	}
 
-	~EmployeeManagement()
+	// Takes ownership of e: the roster keeps a pooled copy and deletes e,
+	// so e must not be used after the call. Returns false, adding nothing,
+	// if an employee with the same name and birth date is already on the
+	// roster.
+	bool addEmployee(Employee *e)
 	{
-		for (Employee *e : employeeList)
+		EMPLOYEE_TIMED_SCOPE(timer, "EmployeeManagement::addEmployee");
+		unique_ptr<Employee> owned(e);
+		if (!duplicates.insert(e->getName(), e->getBirthDate()))
 		{
-			delete e;
+			return false;
 		}
+		appendRow(e->getType(), e->getName(), e->getBirthDate(), unitsOf(e));
+		return true;
 	}
 
-	void addEmployee(Employee *e)
+	// Returns NULL, adding nothing, for a duplicate name and birth date.
+	const OfficeEmployee *createOfficeEmployee(string_view name, string_view birthDate, int workingDays)
 	{
-		employeeList.push_back(e);
+		if (!duplicates.insert(name, birthDate))
+		{
+			return NULL;
+		}
+		OfficeEmployee *e = officePool.create(name, birthDate, workingDays);
+		track(e);
+		return e;
+	}
+
+	const Worker *createWorker(string_view name, string_view birthDate, int noOfProducts)
+	{
+		if (!duplicates.insert(name, birthDate))
+		{
+			return NULL;
+		}
+		Worker *e = workerPool.create(name, birthDate, noOfProducts);
+		track(e);
+		return e;
+	}
+
+	// Bytes held by the manager per employee: pool slabs, the pointer list
+	// and the columnar copy. Interned strings live in the shared StringPool
+	// and are not included.
+	double bytesPerEmployee() const
+	{
+		if (employeeList.empty())
+		{
+			return 0;
+		}
+		size_t bytes = officePool.bytesReserved() + workerPool.bytesReserved() +
+									 employeeList.capacity() * sizeof(Employee *) + columns.bytesReserved();
+		return static_cast<double>(bytes) / employeeList.size();
+	}
+
+	size_t size() const
+	{
+		return employeeList.size();
+	}
+
+	// Mutations go through the manager so the columnar copy stays in sync.
+	bool setWorkingDays(size_t i, int wds)
+	{
+		if (i >= employeeList.size() || employeeList[i]->getType() != EmployeeType::Office)
+		{
+			return false;
+		}
+		static_cast<OfficeEmployee *>(employeeList[i])->setWorkingDays(wds);
+		setUnits(i, wds);
+		return true;
+	}
+
+	bool setNoOfProducts(size_t i, int n)
+	{
+		if (i >= employeeList.size() || employeeList[i]->getType() != EmployeeType::Worker)
+		{
+			return false;
+		}
+		static_cast<Worker *>(employeeList[i])->setNoOfProducts(n);
+		setUnits(i, n);
+		return true;
+	}
+
+	const Employee *getEmployee(size_t i) const
+	{
+		return employeeList[i];
+	}
+
+	// Lookups return employee positions (0-based) in registration order.
+	vector<size_t> findByName(string_view name) const
+	{
+		return index.findByName(name);
+	}
+
+	vector<size_t> findByBirthDate(string_view birthDate) const
+	{
+		return index.findByBirthDate(birthDate);
+	}
+
+	vector<size_t> findByNamePrefix(string_view prefix, size_t limit = 10)
+	{
+		return index.findByNamePrefix(prefix, limit);
+	}
+
+	// Employees born in the calendar years [fromYear, toYear]. Rows whose
+	// birth date is not dd/mm/yyyy never match.
+	vector<size_t> findBornBetween(int fromYear, int toYear)
+	{
+		vector<size_t> rows;
+		columns.parseBirthDays();
+		columns.selectBornBetween(BirthDate::fromCivil(fromYear, 1, 1), BirthDate::fromCivil(toYear, 12, 31), rows);
+		return rows;
+	}
+
+	vector<size_t> findBornBetween(int fromYear, int toYear, EmployeeType type)
+	{
+		vector<size_t> rows;
+		columns.parseBirthDays();
+		columns.selectBornBetween(BirthDate::fromCivil(fromYear, 1, 1), BirthDate::fromCivil(toYear, 12, 31), type, rows);
+		return rows;
+	}
+
+	// Employees whose age on asOfDay (a BirthDate day number) is within
+	// [minAge, maxAge].
+	vector<size_t> findByAge(int minAge, int maxAge, int32_t asOfDay)
+	{
+		vector<size_t> rows;
+		int year, month, day;
+		BirthDate::toCivil(asOfDay, year, month, day);
+		// The birth date on which someone turns `years` old on asOfDay. Someone
+		// born on 29/02 turns a year older on 28/02 in common years: as of
+		// 28/02 of a common year, 29/02 births count; as of 29/02, only a
+		// leap target year has that date.
+		auto turning = [&](int years) {
+			int target = year - years;
+			int targetDay = day;
+			if (month == 2 && day == 29 && !BirthDate::isLeapYear(target))
+			{
+				targetDay = 28;
+			}
+			else if (month == 2 && day == 28 && !BirthDate::isLeapYear(year) && BirthDate::isLeapYear(target))
+			{
+				targetDay = 29;
+			}
+			return BirthDate::fromCivil(target, month, targetDay);
+		};
+		int32_t latest = turning(minAge);
+		int32_t earliest = turning(maxAge + 1) + 1;
+		columns.parseBirthDays();
+		columns.selectBornBetween(earliest, latest, rows);
+		return rows;
+	}
+
+	const EmployeeColumns &getColumns() const
+	{
+		return columns;
+	}
+
+	// The roster packed as 16-byte EmployeeRecords, e.g. to archive or hand
+	// off a large roster; 100M employees take 1.6 GB plus distinct strings.
+	vector<EmployeeRecord> toRecords() const
+	{
+		vector<EmployeeRecord> records;
+		records.reserve(columns.size());
+		for (size_t i = 0; i < columns.size(); i++)
+		{
+			records.push_back(EmployeeRecord::fromColumns(columns, i));
+		}
+		return records;
+	}
+
+	// Appends packed employees, e.g. from toRecords(), skipping duplicates.
+	// Returns the employees added.
+	size_t addRecords(const vector<EmployeeRecord> &records)
+	{
+		reserveMore(records.size());
+		duplicates.reserve(size() + records.size());
+		StringPool &pool = StringPool::shared();
+		char buffer[10];
+		size_t added = 0;
+		for (const EmployeeRecord &r : records)
+		{
+			string_view name = pool.view(r.nameId);
+			string_view birthDate = r.birthDateText(buffer);
+			if (duplicates.insert(name, birthDate))
+			{
+				appendRow(r.type, name, birthDate, r.units);
+				added++;
+			}
+		}
+		return added;
 	}
 
 	void enterList()
 	{
+		EMPLOYEE_TIMED_SCOPE(timer, "EmployeeManagement::enterList");
 		int n;
 		cout << "\n";
 		cout << "========================================\n";
@@ -42,10 +404,11 @@ public:
 		cin.ignore();
 		cout << "\n";
 
+		int registered = 0;
 		for (int i = 0; i < n; i++)
 		{
 			int type;
-			Employee *e = NULL;
+			unique_ptr<Employee> e;
 
 			cout << "----------------------------------------\n";
 			cout << "          Employee #" << i + 1 << " of " << n << "\n";
@@ -63,12 +426,12 @@ public:
 			if (type == 1)
 			{
 				cout << "  >> Adding Office Employee\n\n";
-				e = new OfficeEmployee();
+				e.reset(new OfficeEmployee());
 			}
 			else if (type == 2)
 			{
 				cout << "  >> Adding Worker\n\n";
-				e = new Worker();
+				e.reset(new Worker());
 			}
 			else
 			{
@@ -78,50 +441,321 @@ public:
 			}
 
 			e->enterInfo();
-			employeeList.push_back(e);
+			bool added;
+			if (type == 1)
+			{
+				added = createOfficeEmployee(e->getName(), e->getBirthDate(), unitsOf(e.get())) != NULL;
+			}
+			else
+			{
+				added = createWorker(e->getName(), e->getBirthDate(), unitsOf(e.get())) != NULL;
+			}
 
+			if (!added)
+			{
+				cout << "\n  [!] " << e->getName() << ", born " << e->getBirthDate() << ", is already registered.\n\n";
+				continue;
+			}
+			registered++;
 			cout << "\n  [OK] Employee registered successfully!\n\n";
 		}
 
 		cout << "========================================\n";
-		cout << "   Registration Complete: " << n << " employee(s)\n";
+		cout << "   Registration Complete: " << registered << " employee(s)\n";
 		cout << "========================================\n\n";
 	}
 
-	void displayAll()
+	// Appends a batch of imported rows, dropping anyone whose name and birth
+	// date match an employee already on the roster. Returns the rows added.
+	size_t addBatch(const vector<RosterRow> &rows)
 	{
-		if (employeeList.empty())
+		const size_t prefetchDistance = 8;
+		reserveMore(rows.size());
+		vector<uint64_t> keys(rows.size());
+		for (size_t i = 0; i < rows.size(); i++)
 		{
-			cout << "\n";
-			cout << "  +-----------------------------+\n";
-			cout << "  |    No employees to show     |\n";
-			cout << "  +-----------------------------+\n";
-			return;
+			keys[i] = DuplicateFilter::hashKey(rows[i].name, rows[i].birthDate);
+		}
+		size_t added = 0;
+		for (size_t i = 0; i < rows.size(); i++)
+		{
+			if (i + prefetchDistance < rows.size())
+			{
+				duplicates.prefetch(keys[i + prefetchDistance]);
+			}
+			const RosterRow &row = rows[i];
+			if (duplicates.insert(keys[i], row.name, row.birthDate))
+			{
+				appendRow(row.type, row.name, row.birthDate, row.units);
+				added++;
+			}
+		}
+		return added;
+	}
+
+	// Bulk alternative to enterList(): loads a CSV/TSV roster file. Returns
+	// the employees added, not counting duplicates.
+	size_t importFile(const string &path)
+	{
+		RosterLoader loader;
+		if (!loader.open(path))
+		{
+			cout << "\n  [!] " << loader.getError() << "\n";
+			return 0;
 		}
 
+		duplicates.reserve(size() + loader.estimateRows());
+		size_t added = 0;
+		size_t loaded = loader.load([this, &added](const vector<RosterRow> &batch) { added += addBatch(batch); });
+
 		cout << "\n";
 		cout << "========================================\n";
-		cout << "         ALL EMPLOYEES (" << employeeList.size() << ")\n";
+		cout << "   Import Complete: " << added << " employee(s)\n";
+		if (loader.getSkippedLines() > 0)
+		{
+			cout << "   Skipped malformed lines: " << loader.getSkippedLines() << "\n";
+		}
+		if (loaded > added)
+		{
+			cout << "   Skipped duplicates: " << loaded - added << "\n";
+		}
 		cout << "========================================\n";
+		return added;
+	}
 
-		for (size_t i = 0; i < employeeList.size(); i++)
+	bool saveSnapshot(const string &path)
+	{
+		string error;
+		if (!RosterSnapshot::write(path, columns, error))
 		{
-			cout << "\n  --- Employee #" << i + 1 << " ---";
-			employeeList[i]->describe();
+			cout << "\n  [!] " << error << "\n";
+			return false;
 		}
+		cout << "\n  [OK] Saved " << columns.size() << " employee(s) to " << path << "\n";
+		return true;
+	}
 
-		cout << "\n========================================\n";
-		cout << "          End of List\n";
-		cout << "========================================\n";
+	// Appends the employees of a snapshot written by saveSnapshot(), skipping
+	// anyone already on the roster. Returns the employees added. Verifies
+	// and copies every row, so it is linear in the snapshot; only
+	// RosterSnapshot itself reads the mapping in place.
+	size_t loadSnapshot(const string &path)
+	{
+		RosterSnapshot snapshot;
+		if (!snapshot.open(path))
+		{
+			cout << "\n  [!] " << snapshot.getError() << "\n";
+			return 0;
+		}
+		if (!snapshot.verifyChecksum())
+		{
+			cout << "\n  [!] " << path << " failed its checksum\n";
+			return 0;
+		}
+
+		size_t added = addRows(snapshot);
+		cout << "\n  [OK] Loaded " << added << " employee(s) from " << path << "\n";
+		if (snapshot.size() > added)
+		{
+			cout << "  Skipped duplicates: " << snapshot.size() - added << "\n";
+		}
+		return added;
+	}
+
+	// Recovers the roster from basePath.snap plus the journal tail, then
+	// logs every later mutation (see RosterJournal.h). The manager must be
+	// empty. On failure it keeps whatever was recovered, unjournaled, and
+	// error says why.
+	bool openJournal(const string &basePath, const RosterJournal::Options &options, string &error)
+	{
+		if (journal || !employeeList.empty())
+		{
+			error = "a journal can only be opened on an empty roster";
+			return false;
+		}
+		unique_ptr<RosterJournal> opened(new RosterJournal(basePath, options));
+		RosterSnapshot snapshot;
+		if (snapshot.open(opened->getSnapshotPath()))
+		{
+			if (!snapshot.verifyChecksum())
+			{
+				error = opened->getSnapshotPath() + " failed its checksum";
+				return false;
+			}
+			appendRows(snapshot);
+		}
+		bool ok = opened->open(
+				snapshot.size(),
+				[this](EmployeeType type, string_view name, string_view birthDate, int units) {
+					appendRow(type, name, birthDate, units);
+				},
+				[this](size_t row, int units) {
+					if (columns.typeAt(row) == EmployeeType::Office)
+					{
+						setWorkingDays(row, units);
+					}
+					else
+					{
+						setNoOfProducts(row, units);
+					}
+				});
+		if (!ok)
+		{
+			error = opened->getError();
+			return false;
+		}
+		journal = move(opened);
+		return true;
+	}
+
+	// Null until openJournal() succeeds.
+	RosterJournal *getJournal() const
+	{
+		return journal.get();
+	}
+
+	// Blocks until every mutation so far is durable; true without a journal.
+	bool commitJournal()
+	{
+		return !journal || journal->commit();
+	}
+
+	void displayAll()
+	{
+		EMPLOYEE_TIMED_SCOPE(timer, "EmployeeManagement::displayAll");
+		ReportRenderer renderer(cout);
+		renderer.renderAll(columns);
+		EMPLOYEE_ADD_BYTES(timer, renderer.getBytesWritten());
+	}
+
+	// Rows first..last (one-based, inclusive), rendered without touching the rest.
+	void displayRange(size_t first, size_t last)
+	{
+		ReportRenderer(cout).renderRange(columns, first > 0 ? first - 1 : 0, last);
+	}
+
+	// rows are 0-based positions, e.g. from findBornBetween().
+	void displayRows(const vector<size_t> &rows)
+	{
+		ReportRenderer(cout).renderRows(columns, rows);
+	}
+
+	void displayPage(size_t page, size_t pageSize)
+	{
+		ReportRenderer(cout).renderPage(columns, page, pageSize);
+	}
+
+	// Every row in key order; see RosterOrder.h. Valid until the next
+	// mutation.
+	const vector<uint32_t> &sortedRows(SortKey key)
+	{
+		if (key == SortKey::BirthDate)
+		{
+			columns.parseBirthDays();
+		}
+		return order.sorted(key);
+	}
+
+	vector<size_t> topEarners(size_t n) const
+	{
+		return order.topEarners(n);
+	}
+
+	const RosterOrder &getOrder() const
+	{
+		return order;
+	}
+
+	// Up to count rows of the key order, starting at first (0-based).
+	void displaySorted(SortKey key, size_t first, size_t count)
+	{
+		const vector<uint32_t> &rows = sortedRows(key);
+		size_t last = min(rows.size(), first + count);
+		vector<size_t> page(rows.begin() + min(first, last), rows.begin() + last);
+		displayRows(page);
 	}
 
 	double calculateTotalSalary()
 	{
+		EMPLOYEE_TIMED_SCOPE(timer, "EmployeeManagement::calculateTotalSalary");
+		checkTotals();
+		return totals.totalSalary();
+	}
+
+	// Payroll under one of the precompiled pay schedules. Tiered schedules
+	// are not linear in units, so this scans the columns.
+	double calculateTotalSalary(const PayPolicy &policy) const
+	{
+		return static_cast<double>(policy.sumSalary(columns.types(), columns.units(), 0, columns.size()));
+	}
+
+	// Every aggregate in spec from one pass over the roster; threads == 0
+	// uses every hardware thread.
+	PayrollAggregation aggregate(const AggregationSpec &spec, unsigned threads = 1)
+	{
+		if (spec.groupByBirthYear)
+		{
+			columns.parseBirthDays();
+		}
+		return PayrollAggregation::run(columns, spec, threads);
+	}
+
+	// Records everyone's current working days / products as the payroll of
+	// year/month; see PayrollHistory.h.
+	bool closePayrollPeriod(int year, int month)
+	{
+		return history.closePeriod(year, month, columns);
+	}
+
+	const DuplicateFilter &getDuplicates() const
+	{
+		return duplicates;
+	}
+
+	const PayrollHistory &getHistory() const
+	{
+		return history;
+	}
+
+	// What-if payroll for every scenario, in one sweep over the roster.
+	vector<ScenarioResult> runScenarios(const PayrollScenarios &scenarios) const
+	{
+		return scenarios.run(columns);
+	}
+
+	// Payroll summed over the employee objects rather than the cached
+	// totals. The row's type comes from the columns and the leaf classes
+	// are final, so each calculateSalary() is a direct, inlined call
+	// instead of a virtual one.
+	double recomputeTotalSalary() const
+	{
+		const EmployeeType *types = columns.types();
 		double total = 0;
-		for (Employee *e : employeeList)
+		for (size_t i = 0; i < employeeList.size(); i++)
 		{
-			total += e->calculateSalary();
+			if (types[i] == EmployeeType::Office)
+			{
+				total += static_cast<const OfficeEmployee *>(employeeList[i])->calculateSalary();
+			}
+			else
+			{
+				total += static_cast<const Worker *>(employeeList[i])->calculateSalary();
+			}
 		}
 		return total;
 	}
-};
\ No newline at end of file
+
+	const PayrollTotals &getTotals() const
+	{
+		return totals;
+	}
+
+	// Same total as calculateTotalSalary(), reduced on several threads;
+	// threads == 0 uses every hardware thread.
+	double calculateTotalSalaryParallel(unsigned threads = 0)
+	{
+		return ParallelPayroll(threads).totalSalary(columns);
+	}
+};
+
+#endif // EMPLOYEEMANAGEMENT_CPP
@@ -0,0 +1,110 @@
+#include "EmployeeRecord.h"
+#include "BirthDate.h"
+#include "OfficeEmployee.h"
+#include "Worker.h"
+
+using namespace std;
+
+EmployeeRecord EmployeeRecord::make(EmployeeType type, string_view name, string_view birthDate, int units)
+{
+	StringPool &pool = StringPool::shared();
+	EmployeeRecord r;
+	r.nameId = pool.intern(name);
+	int32_t days;
+	if (BirthDate::parse(birthDate, days))
+	{
+		r.birthDate = packDay(days);
+	}
+	else
+	{
+		r.birthDate = RAW_BIRTH_DATE | pool.intern(birthDate);
+	}
+	r.units = units;
+	r.type = type;
+	r.reserved[0] = r.reserved[1] = r.reserved[2] = 0;
+	return r;
+}
+
+EmployeeRecord EmployeeRecord::fromEmployee(const Employee &e)
+{
+	int units;
+	if (e.getType() == EmployeeType::Office)
+	{
+		units = static_cast<const OfficeEmployee &>(e).getWorkingDays();
+	}
+	else
+	{
+		units = static_cast<const Worker &>(e).getNoOfProducts();
+	}
+	return make(e.getType(), e.getName(), e.getBirthDate(), units);
+}
+
+EmployeeRecord EmployeeRecord::fromColumns(const EmployeeColumns &columns, size_t i)
+{
+	EmployeeRecord r;
+	r.nameId = columns.nameIdAt(i);
+	int32_t days;
+	if (i < columns.parsedBirthDays())
+	{
+		days = columns.birthDayAt(i);
+	}
+	else if (!BirthDate::parse(columns.birthDateAt(i), days))
+	{
+		days = BirthDate::INVALID;
+	}
+	if (days != BirthDate::INVALID)
+	{
+		r.birthDate = packDay(days);
+	}
+	else
+	{
+		r.birthDate = RAW_BIRTH_DATE | columns.birthDateIdAt(i);
+	}
+	r.units = columns.unitsAt(i);
+	r.type = columns.typeAt(i);
+	r.reserved[0] = r.reserved[1] = r.reserved[2] = 0;
+	return r;
+}
+
+Employee *EmployeeRecord::toEmployee() const
+{
+	char buffer[10];
+	string_view name = StringPool::shared().view(nameId);
+	string_view date = birthDateText(buffer);
+	if (type == EmployeeType::Office)
+	{
+		return new OfficeEmployee(name, date, units);
+	}
+	return new Worker(name, date, units);
+}
+
+uint32_t EmployeeRecord::packDay(int32_t days)
+{
+	return static_cast<uint32_t>(days + DAY_BIAS);
+}
+
+bool EmployeeRecord::hasDayNumber() const
+{
+	return (birthDate & RAW_BIRTH_DATE) == 0;
+}
+
+int32_t EmployeeRecord::dayNumber() const
+{
+	return static_cast<int32_t>(birthDate) - DAY_BIAS;
+}
+
+string_view EmployeeRecord::birthDateText(char buffer[10]) const
+{
+	if (!hasDayNumber())
+	{
+		return StringPool::shared().view(birthDate & ~RAW_BIRTH_DATE);
+	}
+	BirthDate::format(dayNumber(), buffer);
+	return string_view(buffer, 10);
+}
+
+double EmployeeRecord::salary() const
+{
+	int rate = type == EmployeeType::Office ? OfficeEmployee::DAILY_RATE : Worker::PRODUCT_RATE;
+	return static_cast<double>(units) * rate;
+}
@@ -0,0 +1,48 @@
+#ifndef EMPLOYEERECORD_H
+#define EMPLOYEERECORD_H
+
+#include "Employee.h"
+#include "EmployeeColumns.h"
+#include <cstdint>
+#include <string_view>
+
+// 16-byte packed employee. Names are StringPool ids. A canonical
+// "dd/mm/yyyy" birth date is stored as a biased day number; any other text
+// is kept verbatim as a StringPool id tagged with RAW_BIRTH_DATE, so
+// packing and unpacking never lose information.
+struct EmployeeRecord
+{
+	static const uint32_t RAW_BIRTH_DATE = 0x80000000u;
+	static const int32_t DAY_BIAS = 1 << 24;
+
+	uint32_t nameId;
+	uint32_t birthDate;
+	int32_t units; // workingDays or noOfProducts
+	EmployeeType type;
+	uint8_t reserved[3];
+
+	static EmployeeRecord make(EmployeeType type, std::string_view name, std::string_view birthDate, int units);
+
+	static EmployeeRecord fromEmployee(const Employee &e);
+
+	// Row i of columns; reuses its interned name and birth date.
+	static EmployeeRecord fromColumns(const EmployeeColumns &columns, size_t i);
+
+	// Allocates a new OfficeEmployee or Worker; the caller owns it.
+	Employee *toEmployee() const;
+
+	static uint32_t packDay(int32_t days);
+
+	bool hasDayNumber() const;
+
+	int32_t dayNumber() const;
+
+	// The birth date as text, formatted into buffer when it is a day number.
+	std::string_view birthDateText(char buffer[10]) const;
+
+	double salary() const;
+};
+
+static_assert(sizeof(EmployeeRecord) == 16, "EmployeeRecord must stay 16 bytes");
+
+#endif // EMPLOYEERECORD_H
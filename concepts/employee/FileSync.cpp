@@ -0,0 +1,45 @@
+#include "FileSync.h"
+#include <filesystem>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace FileSync
+{
+	bool syncFile(FILE *file)
+	{
+		if (fflush(file) != 0)
+		{
+			return false;
+		}
+#ifdef _WIN32
+		return _commit(_fileno(file)) == 0;
+#else
+		return fsync(fileno(file)) == 0;
+#endif
+	}
+
+	bool syncParentDirectory(const string &path)
+	{
+#ifdef _WIN32
+		(void)path;
+		return true;
+#else
+		filesystem::path parent = filesystem::path(path).parent_path();
+		int fd = ::open(parent.empty() ? "." : parent.c_str(), O_RDONLY);
+		if (fd < 0)
+		{
+			return false;
+		}
+		bool ok = fsync(fd) == 0;
+		::close(fd);
+		return ok;
+#endif
+	}
+}
@@ -0,0 +1,19 @@
+#ifndef FILESYNC_H
+#define FILESYNC_H
+
+#include <cstdio>
+#include <string>
+
+// Durability helpers for files that must survive a crash or power loss
+// once written: the data itself, and the directory entry that names it.
+namespace FileSync
+{
+	// Flushes the stdio buffer and waits until the OS has the file on disk.
+	bool syncFile(FILE *file);
+
+	// Makes a create or rename inside path's directory durable. Does
+	// nothing where directories cannot be synced (Windows).
+	bool syncParentDirectory(const std::string &path);
+}
+
+#endif // FILESYNC_H
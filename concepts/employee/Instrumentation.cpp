@@ -0,0 +1,193 @@
+#include "Instrumentation.h"
+
+using namespace std;
+
+namespace
+{
+	// Every probe ever constructed, newest first. Probes are never destroyed
+	// before exit, so the list only grows.
+	atomic<HotPathProbe *> &probeList()
+	{
+		static atomic<HotPathProbe *> head(nullptr);
+		return head;
+	}
+
+	int bucketOf(uint64_t ns)
+	{
+		int b = 0;
+		while (ns != 0 && b < HotPathProbe::BUCKETS - 1)
+		{
+			ns >>= 1;
+			b++;
+		}
+		return b;
+	}
+
+	void appendField(string &json, const char *key, uint64_t value)
+	{
+		json += ",\"";
+		json += key;
+		json += "\":";
+		json += to_string(value);
+	}
+}
+
+HotPathProbe::HotPathProbe(const char *name) : name(name), totalNs(0), maxNs(0), bytes(0)
+{
+	for (int b = 0; b < BUCKETS; b++)
+	{
+		buckets[b].store(0, memory_order_relaxed);
+	}
+	atomic<HotPathProbe *> &head = probeList();
+	next = head.load(memory_order_relaxed);
+	while (!head.compare_exchange_weak(next, this, memory_order_release, memory_order_relaxed))
+	{
+	}
+}
+
+void HotPathProbe::record(uint64_t ns, uint64_t n)
+{
+	// Calls are the sum of the buckets, so a call is two atomic adds.
+	buckets[bucketOf(ns)].fetch_add(1, memory_order_relaxed);
+	totalNs.fetch_add(ns, memory_order_relaxed);
+	if (n != 0)
+	{
+		bytes.fetch_add(n, memory_order_relaxed);
+	}
+	uint64_t seen = maxNs.load(memory_order_relaxed);
+	while (ns > seen && !maxNs.compare_exchange_weak(seen, ns, memory_order_relaxed))
+	{
+	}
+}
+
+void HotPathProbe::reset()
+{
+	totalNs.store(0, memory_order_relaxed);
+	maxNs.store(0, memory_order_relaxed);
+	bytes.store(0, memory_order_relaxed);
+	for (int b = 0; b < BUCKETS; b++)
+	{
+		buckets[b].store(0, memory_order_relaxed);
+	}
+}
+
+const char *HotPathProbe::getName() const
+{
+	return name;
+}
+
+uint64_t HotPathProbe::getCalls() const
+{
+	uint64_t calls = 0;
+	for (int b = 0; b < BUCKETS; b++)
+	{
+		calls += buckets[b].load(memory_order_relaxed);
+	}
+	return calls;
+}
+
+uint64_t HotPathProbe::getTotalNs() const
+{
+	return totalNs.load(memory_order_relaxed);
+}
+
+uint64_t HotPathProbe::getMaxNs() const
+{
+	return maxNs.load(memory_order_relaxed);
+}
+
+uint64_t HotPathProbe::getBytes() const
+{
+	return bytes.load(memory_order_relaxed);
+}
+
+uint64_t HotPathProbe::percentileNs(double p) const
+{
+	uint64_t counts[BUCKETS];
+	uint64_t total = 0;
+	for (int b = 0; b < BUCKETS; b++)
+	{
+		counts[b] = buckets[b].load(memory_order_relaxed);
+		total += counts[b];
+	}
+	if (total == 0)
+	{
+		return 0;
+	}
+	double wanted = p * total;
+	uint64_t seen = 0;
+	for (int b = 0; b < BUCKETS; b++)
+	{
+		seen += counts[b];
+		if (seen >= wanted && counts[b] > 0)
+		{
+			uint64_t top = b == 0 ? 0 : (uint64_t(1) << b) - 1;
+			uint64_t slowest = getMaxNs();
+			return top < slowest ? top : slowest;
+		}
+	}
+	return getMaxNs();
+}
+
+const HotPathProbe *HotPathProbe::getNext() const
+{
+	return next;
+}
+
+namespace Instrumentation
+{
+	bool enabled()
+	{
+#ifdef EMPLOYEE_INSTRUMENTATION
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	string toJson()
+	{
+		string json = "{\"enabled\":";
+		json += enabled() ? "true" : "false";
+		json += ",\"probes\":[";
+		bool first = true;
+		for (const HotPathProbe *p = probeList().load(memory_order_acquire); p; p = p->getNext())
+		{
+			uint64_t calls = p->getCalls();
+			if (!first)
+			{
+				json += ",";
+			}
+			first = false;
+			json += "{\"name\":\"";
+			for (const char *c = p->getName(); *c; c++)
+			{
+				if (*c == '"' || *c == '\\')
+				{
+					json += '\\';
+				}
+				json += *c;
+			}
+			json += "\"";
+			appendField(json, "calls", calls);
+			appendField(json, "totalNs", p->getTotalNs());
+			appendField(json, "meanNs", calls ? p->getTotalNs() / calls : 0);
+			appendField(json, "p50Ns", p->percentileNs(0.5));
+			appendField(json, "p90Ns", p->percentileNs(0.9));
+			appendField(json, "p99Ns", p->percentileNs(0.99));
+			appendField(json, "maxNs", p->getMaxNs());
+			appendField(json, "bytes", p->getBytes());
+			json += "}";
+		}
+		json += "]}";
+		return json;
+	}
+
+	void reset()
+	{
+		for (HotPathProbe *p = probeList().load(memory_order_acquire); p; p = const_cast<HotPathProbe *>(p->getNext()))
+		{
+			p->reset();
+		}
+	}
+}
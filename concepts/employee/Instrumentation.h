@@ -0,0 +1,108 @@
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Call counts, latency and output bytes for the employee hot paths.
+//
+// Sites are marked with EMPLOYEE_TIMED_SCOPE(var, "name"), which times the
+// rest of the enclosing block into a probe of that name. Unless the build
+// defines EMPLOYEE_INSTRUMENTATION the macros expand to nothing, so the
+// probes cost nothing at all when disabled. When enabled, a timed call
+// costs two clock reads and two relaxed atomic adds.
+
+// One instrumented site. Probes are created on first use, live for the
+// rest of the process and may be updated from any thread.
+class HotPathProbe
+{
+public:
+	static const int BUCKETS = 64;
+
+	explicit HotPathProbe(const char *name);
+
+	HotPathProbe(const HotPathProbe &) = delete;
+	HotPathProbe &operator=(const HotPathProbe &) = delete;
+
+	void record(uint64_t ns, uint64_t bytes);
+
+	void reset();
+
+	const char *getName() const;
+	uint64_t getCalls() const;
+	uint64_t getTotalNs() const;
+	uint64_t getMaxNs() const;
+	uint64_t getBytes() const;
+
+	// Latency below which a fraction p of the calls fell, rounded up to the
+	// top of its power-of-two bucket.
+	uint64_t percentileNs(double p) const;
+
+	const HotPathProbe *getNext() const;
+
+private:
+	const char *name;
+	std::atomic<uint64_t> totalNs;
+	std::atomic<uint64_t> maxNs;
+	std::atomic<uint64_t> bytes;
+
+	// buckets[b] counts calls that took [2^(b-1), 2^b) ns; bucket 0 is 0 ns.
+	std::atomic<uint64_t> buckets[BUCKETS];
+
+	HotPathProbe *next;
+};
+
+// Times its own lifetime into a probe.
+class ScopedTimer
+{
+public:
+	explicit ScopedTimer(HotPathProbe &probe)
+			: probe(probe), bytes(0), start(std::chrono::steady_clock::now())
+	{
+	}
+
+	~ScopedTimer()
+	{
+		std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+		probe.record(static_cast<uint64_t>(elapsed.count()), bytes);
+	}
+
+	ScopedTimer(const ScopedTimer &) = delete;
+	ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+	void addBytes(uint64_t n)
+	{
+		bytes += n;
+	}
+
+private:
+	HotPathProbe &probe;
+	uint64_t bytes;
+	std::chrono::steady_clock::time_point start;
+};
+
+namespace Instrumentation
+{
+	// Whether this build was compiled with EMPLOYEE_INSTRUMENTATION.
+	bool enabled();
+
+	// Every probe that has been hit, as one JSON object.
+	std::string toJson();
+
+	void reset();
+}
+
+#ifdef EMPLOYEE_INSTRUMENTATION
+#define EMPLOYEE_TIMED_SCOPE(var, name)      \
+	static HotPathProbe var##Probe(name);      \
+	ScopedTimer var(var##Probe)
+#define EMPLOYEE_ADD_BYTES(var, n) var.addBytes(n)
+#else
+#define EMPLOYEE_TIMED_SCOPE(var, name) ((void)0)
+#define EMPLOYEE_ADD_BYTES(var, n) ((void)0)
+#endif
+
+#endif // INSTRUMENTATION_H
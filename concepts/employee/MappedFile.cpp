@@ -0,0 +1,96 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#include <fstream>
+#include <sstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+MappedFile::MappedFile() : bytes(nullptr), length(0) {}
+
+MappedFile::~MappedFile()
+{
+	close();
+}
+
+bool MappedFile::open(const string &path, bool sequential, string &error)
+{
+	close();
+#ifdef _WIN32
+	(void)sequential;
+	ifstream in(path, ios::binary);
+	if (!in)
+	{
+		error = "cannot open " + path;
+		return false;
+	}
+	ostringstream ss;
+	ss << in.rdbuf();
+	buffer = ss.str();
+	bytes = buffer.data();
+	length = buffer.size();
+#else
+	int fd = ::open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+	{
+		error = "cannot open " + path;
+		return false;
+	}
+	struct stat st;
+	if (fstat(fd, &st) != 0)
+	{
+		::close(fd);
+		error = "cannot stat " + path;
+		return false;
+	}
+	length = static_cast<size_t>(st.st_size);
+	if (length > 0)
+	{
+		void *p = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (p == MAP_FAILED)
+		{
+			::close(fd);
+			length = 0;
+			error = "cannot map " + path;
+			return false;
+		}
+		if (sequential)
+		{
+			madvise(p, length, MADV_SEQUENTIAL);
+		}
+		bytes = static_cast<const char *>(p);
+	}
+	::close(fd);
+#endif
+	return true;
+}
+
+void MappedFile::close()
+{
+#ifdef _WIN32
+	buffer.clear();
+#else
+	if (bytes != nullptr)
+	{
+		munmap(const_cast<char *>(bytes), length);
+	}
+#endif
+	bytes = nullptr;
+	length = 0;
+}
+
+const char *MappedFile::data() const
+{
+	return bytes;
+}
+
+size_t MappedFile::size() const
+{
+	return length;
+}
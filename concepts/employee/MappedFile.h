@@ -0,0 +1,36 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+// Read-only view of a whole file. Uses mmap on POSIX systems and falls
+// back to reading the file into memory elsewhere.
+class MappedFile
+{
+public:
+	MappedFile();
+
+	~MappedFile();
+
+	MappedFile(const MappedFile &) = delete;
+	MappedFile &operator=(const MappedFile &) = delete;
+
+	// sequential hints the kernel that the file will be read front to back.
+	bool open(const std::string &path, bool sequential, std::string &error);
+
+	void close();
+
+	const char *data() const;
+
+	size_t size() const;
+
+private:
+	const char *bytes;
+	size_t length;
+#ifdef _WIN32
+	std::string buffer;
+#endif
+};
+
+#endif // MAPPEDFILE_H
@@ -5,7 +5,7 @@ using namespace std;
 
 OfficeEmployee::OfficeEmployee() : Employee(), workingDays(0) {}
 
-OfficeEmployee::OfficeEmployee(const std::string& name, const std::string& birthDate, int workingDays) 
+OfficeEmployee::OfficeEmployee(std::string_view name, std::string_view birthDate, int workingDays) 
 	: Employee(name, birthDate), workingDays(workingDays)
 {
 }
@@ -17,12 +17,17 @@ void OfficeEmployee::setWorkingDays(int wds)
 	workingDays = wds;
 }
 
-double OfficeEmployee::calculateSalary()
+int OfficeEmployee::getWorkingDays() const
 {
-	return workingDays * 1000;
+	return workingDays;
 }
 
-void OfficeEmployee::describe()
+EmployeeType OfficeEmployee::getType() const
+{
+	return EmployeeType::Office;
+}
+
+void OfficeEmployee::describe() const
 {
 	cout << "\n";
 	cout << "  +-----------------------------+\n";
@@ -2,22 +2,34 @@
 #define OFFICEEMPLOYEE_H
 
 #include "Employee.h"
+#include "PayPolicy.h"
 #include <string>
 
-class OfficeEmployee : public Employee
+class OfficeEmployee final : public Employee
 {
 public:
+	static const int DAILY_RATE = StandardSchedule::OfficeRate::BASE_RATE;
+
 	OfficeEmployee();
 
-	OfficeEmployee(const std::string& name, const std::string& birthDate, int workingDays);
+	OfficeEmployee(std::string_view name, std::string_view birthDate, int workingDays);
 
 	virtual ~OfficeEmployee();
 
 	void setWorkingDays(int wds);
 
-	double calculateSalary() override;
+	int getWorkingDays() const;
+
+	EmployeeType getType() const override;
+
+	// Defined inline, and the class is final, so any call through an
+	// OfficeEmployee (not just the variant backend's) is direct and inlines.
+	double calculateSalary() const override
+	{
+		return static_cast<double>(StandardSchedule::OfficeRate::pay(workingDays));
+	}
 
-	void describe() override;
+	void describe() const override;
 
 	void enterInfo() override;
 
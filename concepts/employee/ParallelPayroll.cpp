@@ -0,0 +1,50 @@
+#include "ParallelPayroll.h"
+
+using namespace std;
+
+ParallelPayroll::ParallelPayroll(unsigned threads) : threads(threads)
+{
+	if (this->threads == 0)
+	{
+		this->threads = thread::hardware_concurrency();
+	}
+	if (this->threads == 0)
+	{
+		this->threads = 1;
+	}
+}
+
+unsigned ParallelPayroll::getThreads() const
+{
+	return threads;
+}
+
+size_t ParallelPayroll::blockCount(size_t rows)
+{
+	return (rows + BLOCK_SIZE - 1) / BLOCK_SIZE;
+}
+
+double ParallelPayroll::totalSalary(const EmployeeColumns &columns) const
+{
+	size_t rows = columns.size();
+	vector<double> partials(blockCount(rows));
+	forEachBlock(rows, [&](size_t block, size_t first, size_t last) {
+		partials[block] = static_cast<double>(columns.sumSalary(first, last));
+	});
+	return pairwiseSum(partials.data(), partials.size());
+}
+
+double ParallelPayroll::pairwiseSum(const double *values, size_t n)
+{
+	if (n <= 8)
+	{
+		double sum = 0;
+		for (size_t i = 0; i < n; i++)
+		{
+			sum += values[i];
+		}
+		return sum;
+	}
+	size_t half = n / 2;
+	return pairwiseSum(values, half) + pairwiseSum(values + half, n - half);
+}
@@ -0,0 +1,74 @@
+#ifndef PARALLELPAYROLL_H
+#define PARALLELPAYROLL_H
+
+#include "EmployeeColumns.h"
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+// Multi-threaded payroll reduction over EmployeeColumns.
+//
+// Rows are cut into fixed blocks of BLOCK_SIZE. Each block is reduced on
+// its own and the block results are combined by pairwise summation in
+// block order. Block boundaries and the combination tree depend only on
+// the number of rows, never on the number of threads, so the total is
+// bit-identical for any thread count.
+class ParallelPayroll
+{
+public:
+	static const size_t BLOCK_SIZE = 16384;
+
+	// threads == 0 uses std::thread::hardware_concurrency().
+	explicit ParallelPayroll(unsigned threads = 0);
+
+	unsigned getThreads() const;
+
+	double totalSalary(const EmployeeColumns &columns) const;
+
+	static size_t blockCount(size_t rows);
+
+	// Calls f(block, first, last) for every block, spreading contiguous runs
+	// of blocks over the worker threads. The calling thread takes the first run.
+	template <typename F>
+	void forEachBlock(size_t rows, F f) const
+	{
+		size_t blocks = blockCount(rows);
+		size_t workers = threads < blocks ? threads : blocks;
+		if (workers <= 1)
+		{
+			runBlocks(rows, 0, blocks, f);
+			return;
+		}
+		std::vector<std::thread> pool;
+		pool.reserve(workers - 1);
+		for (size_t t = 1; t < workers; t++)
+		{
+			size_t firstBlock = blocks * t / workers;
+			size_t lastBlock = blocks * (t + 1) / workers;
+			pool.emplace_back([rows, firstBlock, lastBlock, &f]() { runBlocks(rows, firstBlock, lastBlock, f); });
+		}
+		runBlocks(rows, 0, blocks / workers, f);
+		for (std::thread &worker : pool)
+		{
+			worker.join();
+		}
+	}
+
+	static double pairwiseSum(const double *values, size_t n);
+
+private:
+	template <typename F>
+	static void runBlocks(size_t rows, size_t firstBlock, size_t lastBlock, F &f)
+	{
+		for (size_t b = firstBlock; b < lastBlock; b++)
+		{
+			size_t first = b * BLOCK_SIZE;
+			size_t last = first + BLOCK_SIZE < rows ? first + BLOCK_SIZE : rows;
+			f(b, first, last);
+		}
+	}
+
+	unsigned threads;
+};
+
+#endif // PARALLELPAYROLL_H
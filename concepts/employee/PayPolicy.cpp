@@ -0,0 +1,39 @@
+#include "PayPolicy.h"
+
+using namespace std;
+
+namespace
+{
+	const PayPolicy POLICIES[] = {
+			makePayPolicy<StandardSchedule>("standard", "1000 per working day, 5000 per product"),
+			makePayPolicy<OvertimeSchedule>("overtime", "standard, office days beyond 22 at 1500"),
+			makePayPolicy<PieceworkSchedule>("piecework", "standard, products beyond 100 at 5500 and beyond 150 at 6000"),
+	};
+}
+
+const PayPolicy &PayPolicy::standard()
+{
+	return POLICIES[0];
+}
+
+const PayPolicy *PayPolicy::find(string_view name)
+{
+	for (const PayPolicy &policy : POLICIES)
+	{
+		if (name == policy.name)
+		{
+			return &policy;
+		}
+	}
+	return nullptr;
+}
+
+const PayPolicy *PayPolicy::all()
+{
+	return POLICIES;
+}
+
+size_t PayPolicy::count()
+{
+	return sizeof(POLICIES) / sizeof(POLICIES[0]);
+}
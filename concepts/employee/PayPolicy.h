@@ -0,0 +1,135 @@
+#ifndef PAYPOLICY_H
+#define PAYPOLICY_H
+
+#include "Employee.h"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+// Pay schedules as compile-time parameters. A schedule is a type, so the
+// compiler folds its rates and tiers into straight-line code wherever it
+// is used; PayPolicy then exposes the precompiled schedules for selection
+// at run time, with one indirect call per scan instead of one per row.
+
+// Marginal rate tiers given as (from, rate) pairs: units above each
+// "from" are paid at that tier's rate. The first tier must start at 0.
+//   TieredRate<0, 1000, 22, 1500>  // 1000 a day, 1500 from the 23rd day
+template <int... FromRate>
+struct TieredRate
+{
+	static_assert(sizeof...(FromRate) >= 2 && sizeof...(FromRate) % 2 == 0, "TieredRate takes (from, rate) pairs");
+
+	static constexpr int spec[] = {FromRate...};
+	static constexpr size_t TIERS = sizeof...(FromRate) / 2;
+	static constexpr int BASE_RATE = spec[1];
+
+	static constexpr bool wellFormed()
+	{
+		if (spec[0] != 0)
+		{
+			return false;
+		}
+		for (size_t t = 1; t < TIERS; t++)
+		{
+			if (spec[2 * t] <= spec[2 * t - 2])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static_assert(wellFormed(), "TieredRate tiers must start at 0 and ascend");
+
+	static constexpr int64_t pay(int units)
+	{
+		return payTiers(units, std::make_index_sequence<TIERS>());
+	}
+
+private:
+	// Tier t adds (rate_t - rate_t-1) for every unit above from_t, so each
+	// tier is a max and a multiply with no branches.
+	template <size_t T>
+	static constexpr int64_t tierPay(int64_t units)
+	{
+		if constexpr (T == 0)
+		{
+			return units * spec[1];
+		}
+		else
+		{
+			int64_t above = units - spec[2 * T];
+			return (above > 0 ? above : 0) * (spec[2 * T + 1] - spec[2 * T - 1]);
+		}
+	}
+
+	template <size_t... T>
+	static constexpr int64_t payTiers(int64_t units, std::index_sequence<T...>)
+	{
+		return (tierPay<T>(units) + ...);
+	}
+};
+
+template <typename OfficePay, typename WorkerPay>
+struct PaySchedule
+{
+	using OfficeRate = OfficePay;
+	using WorkerRate = WorkerPay;
+
+	static constexpr int64_t salaryOf(EmployeeType type, int units)
+	{
+		return type == EmployeeType::Office ? OfficePay::pay(units) : WorkerPay::pay(units);
+	}
+
+	// Exact payroll of rows [first, last) of a type/units column pair.
+	static int64_t sumSalary(const EmployeeType *types, const int32_t *units, size_t first, size_t last)
+	{
+		int64_t total = 0;
+		for (size_t i = first; i < last; i++)
+		{
+			int64_t office = OfficePay::pay(units[i]);
+			int64_t worker = WorkerPay::pay(units[i]);
+			total += types[i] == EmployeeType::Office ? office : worker;
+		}
+		return total;
+	}
+};
+
+// The flat rates the company has always paid.
+using StandardSchedule = PaySchedule<TieredRate<0, 1000>, TieredRate<0, 5000>>;
+
+// Office days beyond 22 in a period are paid time and a half.
+using OvertimeSchedule = PaySchedule<TieredRate<0, 1000, 22, 1500>, TieredRate<0, 5000>>;
+
+// Piece-rate brackets: products beyond 100 and 150 earn more each.
+using PieceworkSchedule = PaySchedule<TieredRate<0, 1000>, TieredRate<0, 5000, 100, 5500, 150, 6000>>;
+
+static_assert(StandardSchedule::salaryOf(EmployeeType::Office, 20) == 20000, "standard office rate");
+static_assert(OvertimeSchedule::salaryOf(EmployeeType::Office, 24) == 25000, "overtime tier");
+static_assert(PieceworkSchedule::salaryOf(EmployeeType::Worker, 160) == 835000, "piece-rate brackets");
+
+// Runtime handle to one of the schedules above.
+struct PayPolicy
+{
+	const char *name;
+	const char *description;
+	int64_t (*salaryOf)(EmployeeType type, int units);
+	int64_t (*sumSalary)(const EmployeeType *types, const int32_t *units, size_t first, size_t last);
+
+	static const PayPolicy &standard();
+
+	// nullptr when no schedule has that name.
+	static const PayPolicy *find(std::string_view name);
+
+	static const PayPolicy *all();
+	static size_t count();
+};
+
+template <typename Schedule>
+constexpr PayPolicy makePayPolicy(const char *name, const char *description)
+{
+	return PayPolicy{name, description, &Schedule::salaryOf, &Schedule::sumSalary};
+}
+
+#endif // PAYPOLICY_H
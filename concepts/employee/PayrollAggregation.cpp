@@ -0,0 +1,326 @@
+#include "PayrollAggregation.h"
+#include "BirthDate.h"
+#include "OfficeEmployee.h"
+#include "ParallelPayroll.h"
+#include "Worker.h"
+#include <algorithm>
+#include <thread>
+#include <utility>
+
+using namespace std;
+
+namespace
+{
+	const int64_t RATES[2] = {OfficeEmployee::DAILY_RATE, Worker::PRODUCT_RATE};
+
+	int typeIndex(EmployeeType type)
+	{
+		return type == EmployeeType::Office ? 0 : 1;
+	}
+
+	// Orders earners best first: higher salary, then earlier row.
+	bool earnsMore(const TopEarner &a, const TopEarner &b)
+	{
+		return a.salary > b.salary || (a.salary == b.salary && a.row < b.row);
+	}
+}
+
+PayrollAggregation::PayrollAggregation(const AggregationSpec &spec)
+		: spec(spec), yearGroups(spec.groupByBirthYear ? YEARS : 1)
+{
+	top.reserve(spec.topK);
+}
+
+void PayrollAggregation::UnitCounts::addSlow(int typeIndex, int32_t units)
+{
+	vector<uint64_t> &counts = dense[typeIndex];
+	if (units >= 0 && units < DENSE_UNITS)
+	{
+		size_t grown = max(static_cast<size_t>(units) + 1, counts.size() * 2);
+		counts.resize(min(grown, static_cast<size_t>(DENSE_UNITS)));
+		counts[units]++;
+	}
+	else
+	{
+		sparse[typeIndex][units]++;
+	}
+}
+
+void PayrollAggregation::UnitCounts::merge(const UnitCounts &other)
+{
+	for (int t = 0; t < 2; t++)
+	{
+		if (dense[t].size() < other.dense[t].size())
+		{
+			dense[t].resize(other.dense[t].size());
+		}
+		for (size_t u = 0; u < other.dense[t].size(); u++)
+		{
+			dense[t][u] += other.dense[t][u];
+		}
+		for (const pair<const int32_t, uint64_t> &entry : other.sparse[t])
+		{
+			sparse[t][entry.first] += entry.second;
+		}
+	}
+}
+
+bool PayrollAggregation::UnitCounts::empty() const
+{
+	return dense[0].empty() && dense[1].empty() && sparse[0].empty() && sparse[1].empty();
+}
+
+PayrollAggregation::UnitCounts &PayrollAggregation::groupOf(int32_t birthDay)
+{
+	// First day of each year in the table. A 400-year span is exactly one
+	// Gregorian cycle, so a linear estimate is never more than a year off.
+	static const vector<int32_t> yearStarts = []() {
+		vector<int32_t> starts(YEARS + 1);
+		for (int y = 0; y <= YEARS; y++)
+		{
+			starts[y] = BirthDate::fromCivil(FIRST_YEAR + y, 1, 1);
+		}
+		return starts;
+	}();
+
+	if (birthDay == BirthDate::INVALID)
+	{
+		return otherYears[SalaryAggregate::UNKNOWN_YEAR];
+	}
+	int64_t span = yearStarts[YEARS] - yearStarts[0];
+	int64_t offset = static_cast<int64_t>(birthDay) - yearStarts[0];
+	if (offset < 0 || offset >= span)
+	{
+		return otherYears[BirthDate::yearOf(birthDay)];
+	}
+	size_t y = static_cast<size_t>(offset * YEARS / span);
+	if (birthDay < yearStarts[y])
+	{
+		y--;
+	}
+	else if (birthDay >= yearStarts[y + 1])
+	{
+		y++;
+	}
+	return yearGroups[y];
+}
+
+void PayrollAggregation::offer(size_t row, int64_t salary)
+{
+	TopEarner candidate = {row, salary};
+	if (top.size() < spec.topK)
+	{
+		top.push_back(candidate);
+		push_heap(top.begin(), top.end(), earnsMore);
+	}
+	else if (earnsMore(candidate, top.front()))
+	{
+		pop_heap(top.begin(), top.end(), earnsMore);
+		top.back() = candidate;
+		push_heap(top.begin(), top.end(), earnsMore);
+	}
+}
+
+void PayrollAggregation::addRows(const EmployeeColumns &columns, size_t first, size_t last)
+{
+	const EmployeeType *types = columns.types();
+	const int32_t *units = columns.units();
+	const int32_t *days = columns.birthDays();
+	size_t parsed = columns.parsedBirthDays();
+	bool ranking = spec.topK > 0;
+
+	for (size_t i = first; i < last; i++)
+	{
+		int t = typeIndex(types[i]);
+		UnitCounts &counts = !spec.groupByBirthYear ? yearGroups[0]
+													: groupOf(i < parsed ? days[i] : BirthDate::INVALID);
+		counts.add(t, units[i]);
+		if (ranking)
+		{
+			offer(i, units[i] * RATES[t]);
+		}
+	}
+}
+
+void PayrollAggregation::merge(const PayrollAggregation &other)
+{
+	for (size_t y = 0; y < yearGroups.size(); y++)
+	{
+		yearGroups[y].merge(other.yearGroups[y]);
+	}
+	for (const pair<const int, UnitCounts> &entry : other.otherYears)
+	{
+		otherYears[entry.first].merge(entry.second);
+	}
+	for (const TopEarner &earner : other.top)
+	{
+		offer(earner.row, earner.salary);
+	}
+}
+
+SalaryAggregate PayrollAggregation::summarize(const UnitCounts &counts, bool allTypes, EmployeeType type, int birthYear) const
+{
+	// (salary, employees) for every distinct salary, ascending.
+	vector<pair<int64_t, uint64_t>> values;
+	for (int t = 0; t < 2; t++)
+	{
+		if (!allTypes && t != typeIndex(type))
+		{
+			continue;
+		}
+		for (size_t u = 0; u < counts.dense[t].size(); u++)
+		{
+			if (counts.dense[t][u] > 0)
+			{
+				values.emplace_back(static_cast<int64_t>(u) * RATES[t], counts.dense[t][u]);
+			}
+		}
+		for (const pair<const int32_t, uint64_t> &entry : counts.sparse[t])
+		{
+			values.emplace_back(entry.first * RATES[t], entry.second);
+		}
+	}
+	sort(values.begin(), values.end());
+
+	SalaryAggregate aggregate;
+	aggregate.allTypes = allTypes;
+	aggregate.type = type;
+	aggregate.birthYear = birthYear;
+	aggregate.count = 0;
+	aggregate.total = 0;
+	aggregate.min = 0;
+	aggregate.max = 0;
+	aggregate.mean = 0;
+	aggregate.histogramStart = 0;
+	if (values.empty())
+	{
+		return aggregate;
+	}
+
+	for (const pair<int64_t, uint64_t> &value : values)
+	{
+		aggregate.count += value.second;
+		aggregate.total += value.first * static_cast<int64_t>(value.second);
+	}
+	aggregate.min = values.front().first;
+	aggregate.max = values.back().first;
+	aggregate.mean = static_cast<double>(aggregate.total) / aggregate.count;
+
+	for (double p : spec.percentiles)
+	{
+		// Nearest rank: the smallest salary with at least p * count employees at or below it.
+		double wanted = p * aggregate.count;
+		uint64_t rank = wanted <= 1 ? 1 : static_cast<uint64_t>(wanted);
+		rank += rank < wanted ? 1 : 0;
+		uint64_t seen = 0;
+		int64_t salary = aggregate.max;
+		for (const pair<int64_t, uint64_t> &value : values)
+		{
+			seen += value.second;
+			if (seen >= rank)
+			{
+				salary = value.first;
+				break;
+			}
+		}
+		aggregate.percentiles.push_back(salary);
+	}
+
+	int64_t width = spec.histogramWidth;
+	if (width > 0)
+	{
+		int64_t start = aggregate.min / width * width;
+		if (start > aggregate.min)
+		{
+			start -= width;
+		}
+		aggregate.histogramStart = start;
+		aggregate.histogram.assign(static_cast<size_t>((aggregate.max - start) / width) + 1, 0);
+		for (const pair<int64_t, uint64_t> &value : values)
+		{
+			aggregate.histogram[static_cast<size_t>((value.first - start) / width)] += value.second;
+		}
+	}
+	return aggregate;
+}
+
+vector<SalaryAggregate> PayrollAggregation::groups() const
+{
+	// Year groups in year order: the table sits between the years below and above it.
+	vector<pair<int, const UnitCounts *>> years;
+	if (!spec.groupByBirthYear)
+	{
+		years.emplace_back(SalaryAggregate::ALL_YEARS, &yearGroups[0]);
+	}
+	else
+	{
+		map<int, UnitCounts>::const_iterator other = otherYears.begin();
+		for (; other != otherYears.end() && other->first < FIRST_YEAR; ++other)
+		{
+			years.emplace_back(other->first, &other->second);
+		}
+		for (size_t y = 0; y < yearGroups.size(); y++)
+		{
+			years.emplace_back(FIRST_YEAR + static_cast<int>(y), &yearGroups[y]);
+		}
+		for (; other != otherYears.end(); ++other)
+		{
+			years.emplace_back(other->first, &other->second);
+		}
+	}
+
+	vector<SalaryAggregate> result;
+	for (int t = spec.groupByType ? 1 : 0; t < (spec.groupByType ? 3 : 1); t++)
+	{
+		EmployeeType type = t == 2 ? EmployeeType::Worker : EmployeeType::Office;
+		for (const pair<int, const UnitCounts *> &year : years)
+		{
+			if (year.second->empty())
+			{
+				continue;
+			}
+			SalaryAggregate aggregate = summarize(*year.second, t == 0, type, year.first);
+			if (aggregate.count > 0)
+			{
+				result.push_back(move(aggregate));
+			}
+		}
+	}
+	return result;
+}
+
+vector<TopEarner> PayrollAggregation::topEarners() const
+{
+	vector<TopEarner> ranked = top;
+	sort(ranked.begin(), ranked.end(), earnsMore);
+	return ranked;
+}
+
+PayrollAggregation PayrollAggregation::run(const EmployeeColumns &columns, const AggregationSpec &spec, unsigned threads)
+{
+	size_t rows = columns.size();
+	size_t workers = ParallelPayroll(threads).getThreads();
+	size_t blocks = ParallelPayroll::blockCount(rows);
+	workers = max<size_t>(1, min(workers, blocks));
+
+	// One partial per thread over a contiguous run of blocks, merged in
+	// row order; the counts are exact, so the split does not matter.
+	vector<PayrollAggregation> partials(workers, PayrollAggregation(spec));
+	vector<thread> pool;
+	for (size_t t = 1; t < workers; t++)
+	{
+		size_t first = min(rows, blocks * t / workers * ParallelPayroll::BLOCK_SIZE);
+		size_t last = min(rows, blocks * (t + 1) / workers * ParallelPayroll::BLOCK_SIZE);
+		pool.emplace_back([&columns, &partials, t, first, last]() { partials[t].addRows(columns, first, last); });
+	}
+	partials[0].addRows(columns, 0, min(rows, blocks / workers * ParallelPayroll::BLOCK_SIZE));
+	for (thread &worker : pool)
+	{
+		worker.join();
+	}
+	for (size_t t = 1; t < workers; t++)
+	{
+		partials[0].merge(partials[t]);
+	}
+	return move(partials[0]);
+}
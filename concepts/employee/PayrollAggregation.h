@@ -0,0 +1,134 @@
+#ifndef PAYROLLAGGREGATION_H
+#define PAYROLLAGGREGATION_H
+
+#include "EmployeeColumns.h"
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+// What one aggregation pass computes. Every group gets count, total,
+// min, max and mean salary; the rest is opt-in.
+struct AggregationSpec
+{
+	bool groupByType = false;
+	bool groupByBirthYear = false;
+
+	// Fractions in [0, 1], e.g. {0.5, 0.9, 0.99}; nearest-rank.
+	std::vector<double> percentiles;
+
+	// Salary bucket width; 0 for no histogram.
+	int64_t histogramWidth = 0;
+
+	// Highest earners over the whole roster; 0 for none.
+	size_t topK = 0;
+};
+
+struct SalaryAggregate
+{
+	static constexpr int ALL_YEARS = INT_MIN;
+	static constexpr int UNKNOWN_YEAR = INT_MIN + 1; // birth date is not dd/mm/yyyy
+
+	bool allTypes;
+	EmployeeType type; // meaningful when !allTypes
+	int birthYear;		 // ALL_YEARS when not grouped by year
+
+	size_t count;
+	int64_t total;
+	int64_t min;
+	int64_t max;
+	double mean;
+
+	// One per AggregationSpec::percentiles, in the same order.
+	std::vector<int64_t> percentiles;
+
+	// histogram[b] counts salaries in [histogramStart + b * width, + width).
+	int64_t histogramStart;
+	std::vector<size_t> histogram;
+};
+
+struct TopEarner
+{
+	size_t row;
+	int64_t salary;
+};
+
+// Computes every aggregate of an AggregationSpec in one fused pass over
+// EmployeeColumns. The pass only counts how many employees of each type
+// have each units value (per birth year when grouping by year) and keeps
+// a bounded heap of top earners; salaries, percentiles and histograms are
+// derived from those counts afterwards, so nothing is copied or sorted
+// per row. Counts are exact integers, so partial aggregations over
+// disjoint row ranges merge into exactly the single-threaded result.
+class PayrollAggregation
+{
+public:
+	explicit PayrollAggregation(const AggregationSpec &spec);
+
+	// Grouping by birth year uses the birth days from parseBirthDays();
+	// rows it has not covered yet count as UNKNOWN_YEAR.
+	void addRows(const EmployeeColumns &columns, size_t first, size_t last);
+
+	// Folds in a partial aggregation of the same spec over other rows.
+	void merge(const PayrollAggregation &other);
+
+	// Groups ordered by type (all, office, worker) then birth year; empty
+	// groups are left out.
+	std::vector<SalaryAggregate> groups() const;
+
+	// Highest salary first; equal salaries in roster order.
+	std::vector<TopEarner> topEarners() const;
+
+	// The whole roster, split over threads (0 = every hardware thread).
+	static PayrollAggregation run(const EmployeeColumns &columns, const AggregationSpec &spec, unsigned threads = 1);
+
+private:
+	// Employees per units value for each type: dense for the usual small
+	// counts, a map for anything else.
+	struct UnitCounts
+	{
+		static const int32_t DENSE_UNITS = 1024;
+
+		std::vector<uint64_t> dense[2];
+		std::map<int32_t, uint64_t> sparse[2];
+
+		void add(int typeIndex, int32_t units)
+		{
+			std::vector<uint64_t> &counts = dense[typeIndex];
+			if (static_cast<uint32_t>(units) < counts.size())
+			{
+				counts[units]++;
+			}
+			else
+			{
+				addSlow(typeIndex, units);
+			}
+		}
+
+		void addSlow(int typeIndex, int32_t units);
+		void merge(const UnitCounts &other);
+		bool empty() const;
+	};
+
+	static const int FIRST_YEAR = 1800;
+	static const int YEARS = 400;
+
+	UnitCounts &groupOf(int32_t birthDay);
+
+	void offer(size_t row, int64_t salary);
+
+	SalaryAggregate summarize(const UnitCounts &counts, bool allTypes, EmployeeType type, int birthYear) const;
+
+	AggregationSpec spec;
+
+	// Years FIRST_YEAR .. FIRST_YEAR + YEARS - 1, or the single group when
+	// not grouping by year; other years and UNKNOWN_YEAR go to otherYears.
+	std::vector<UnitCounts> yearGroups;
+	std::map<int, UnitCounts> otherYears;
+
+	// Min-heap on (salary, -row) holding the best topK rows seen so far.
+	std::vector<TopEarner> top;
+};
+
+#endif // PAYROLLAGGREGATION_H
@@ -0,0 +1,382 @@
+#include "PayrollHistory.h"
+#include "OfficeEmployee.h"
+#include "Worker.h"
+#include <algorithm>
+
+using namespace std;
+
+namespace
+{
+	const int64_t RATES[2] = {OfficeEmployee::DAILY_RATE, Worker::PRODUCT_RATE};
+
+	unsigned bitsFor(uint32_t range)
+	{
+		unsigned bits = 0;
+		while (range != 0)
+		{
+			range >>= 1;
+			bits++;
+		}
+		return bits;
+	}
+}
+
+PayrollHistory::PayrollHistory()
+{
+}
+
+int PayrollHistory::keyOf(int year, int month)
+{
+	return year * 12 + month - 1;
+}
+
+int PayrollHistory::typeIndex(EmployeeType type)
+{
+	return type == EmployeeType::Office ? 0 : 1;
+}
+
+bool PayrollHistory::closePeriod(int year, int month, const EmployeeColumns &columns)
+{
+	if (month < 1 || month > 12)
+	{
+		error = "month must be 1..12";
+		return false;
+	}
+	int key = keyOf(year, month);
+	if (!history.empty() && key <= history.back().key)
+	{
+		error = "periods must be closed in order";
+		return false;
+	}
+	if (columns.size() < rowTypes.size())
+	{
+		error = "the roster lost rows since the last period";
+		return false;
+	}
+
+	for (size_t row = rowTypes.size(); row < columns.size(); row++)
+	{
+		EmployeeType type = columns.typeAt(row);
+		vector<uint32_t> &rows = rowsOfType[typeIndex(type)];
+		rowTypes.push_back(type);
+		rankOfRow.push_back(static_cast<uint32_t>(rows.size()));
+		rows.push_back(static_cast<uint32_t>(row));
+	}
+
+	history.emplace_back();
+	Period &period = history.back();
+	period.key = key;
+	const int32_t *units = columns.units();
+	vector<int32_t> values;
+	for (int t = 0; t < 2; t++)
+	{
+		const vector<uint32_t> &rows = rowsOfType[t];
+		values.resize(rows.size());
+		for (size_t i = 0; i < rows.size(); i++)
+		{
+			values[i] = units[rows[i]];
+		}
+		pack(values.data(), values.size(), period.columns[t]);
+	}
+	return true;
+}
+
+void PayrollHistory::pack(const int32_t *values, size_t n, PackedColumn &column)
+{
+	column.count = n;
+	size_t blocks = (n + BLOCK - 1) / BLOCK;
+	column.blocks.resize(blocks);
+	column.words.clear();
+	for (size_t b = 0; b < blocks; b++)
+	{
+		const int32_t *block = values + b * BLOCK;
+		size_t count = min(BLOCK, n - b * BLOCK);
+		int32_t lo = *min_element(block, block + count);
+		int32_t hi = *max_element(block, block + count);
+		unsigned width = bitsFor(static_cast<uint32_t>(hi) - static_cast<uint32_t>(lo));
+		column.blocks[b] = BlockHeader{lo, static_cast<uint32_t>(column.words.size()), width};
+
+		// Each lane holds 32 values of width bits: width words per lane.
+		size_t first = column.words.size();
+		column.words.resize(first + width * LANES, 0);
+		uint32_t *out = column.words.data() + first;
+		for (size_t j = 0; j < count && width > 0; j++)
+		{
+			uint32_t v = static_cast<uint32_t>(block[j]) - static_cast<uint32_t>(lo);
+			size_t lane = j % LANES;
+			unsigned bit = static_cast<unsigned>(j / LANES) * width;
+			unsigned off = bit & 31;
+			out[(bit >> 5) * LANES + lane] |= v << off;
+			if (off + width > 32)
+			{
+				out[((bit >> 5) + 1) * LANES + lane] |= v >> (32 - off);
+			}
+		}
+	}
+	column.words.shrink_to_fit();
+}
+
+void PayrollHistory::unpackBlock(const uint32_t *words, unsigned width, uint32_t *out)
+{
+	if (width == 0)
+	{
+		fill(out, out + BLOCK, 0u);
+		return;
+	}
+	uint32_t mask = width == 32 ? ~0u : (1u << width) - 1;
+	for (unsigned k = 0; k < 32; k++)
+	{
+		unsigned bit = k * width;
+		unsigned off = bit & 31;
+		const uint32_t *lo = words + (bit >> 5) * LANES;
+		uint32_t *dst = out + k * LANES;
+		// Same shift in every lane: these inner loops vectorize.
+		if (off + width <= 32)
+		{
+			for (size_t lane = 0; lane < LANES; lane++)
+			{
+				dst[lane] = (lo[lane] >> off) & mask;
+			}
+		}
+		else
+		{
+			const uint32_t *hi = lo + LANES;
+			for (size_t lane = 0; lane < LANES; lane++)
+			{
+				dst[lane] = ((lo[lane] >> off) | (hi[lane] << (32 - off))) & mask;
+			}
+		}
+	}
+}
+
+int32_t PayrollHistory::valueAt(const PackedColumn &column, size_t i)
+{
+	const BlockHeader &header = column.blocks[i / BLOCK];
+	size_t j = i % BLOCK;
+	unsigned width = header.width;
+	if (width == 0)
+	{
+		return header.base;
+	}
+	const uint32_t *words = column.words.data() + header.offset;
+	unsigned bit = static_cast<unsigned>(j / LANES) * width;
+	unsigned off = bit & 31;
+	size_t lane = j % LANES;
+	uint64_t pair = words[(bit >> 5) * LANES + lane];
+	if (off + width > 32)
+	{
+		pair |= static_cast<uint64_t>(words[((bit >> 5) + 1) * LANES + lane]) << 32;
+	}
+	uint32_t v = static_cast<uint32_t>(pair >> off) & (width == 32 ? ~0u : (1u << width) - 1);
+	return static_cast<int32_t>(static_cast<uint32_t>(header.base) + v);
+}
+
+uint64_t PayrollHistory::sumBlock(const uint32_t *words, unsigned width)
+{
+	// Up to 27 bits, 32 values per lane cannot overflow a 32-bit lane sum,
+	// so decoding and summing fuse into one pass over the packed words.
+	if (width > 27)
+	{
+		uint32_t buffer[BLOCK];
+		unpackBlock(words, width, buffer);
+		uint64_t total = 0;
+		for (size_t j = 0; j < BLOCK; j++)
+		{
+			total += buffer[j];
+		}
+		return total;
+	}
+	uint32_t mask = (1u << width) - 1;
+	uint32_t sums[LANES] = {};
+	for (unsigned k = 0; k < 32; k++)
+	{
+		unsigned bit = k * width;
+		unsigned off = bit & 31;
+		const uint32_t *lo = words + (bit >> 5) * LANES;
+		if (off + width <= 32)
+		{
+			for (size_t lane = 0; lane < LANES; lane++)
+			{
+				sums[lane] += (lo[lane] >> off) & mask;
+			}
+		}
+		else
+		{
+			const uint32_t *hi = lo + LANES;
+			for (size_t lane = 0; lane < LANES; lane++)
+			{
+				sums[lane] += ((lo[lane] >> off) | (hi[lane] << (32 - off))) & mask;
+			}
+		}
+	}
+	uint64_t total = 0;
+	for (size_t lane = 0; lane < LANES; lane++)
+	{
+		total += sums[lane];
+	}
+	return total;
+}
+
+int64_t PayrollHistory::sum(const PackedColumn &column)
+{
+	int64_t total = 0;
+	for (size_t b = 0; b < column.blocks.size(); b++)
+	{
+		const BlockHeader &header = column.blocks[b];
+		size_t count = min(BLOCK, column.count - b * BLOCK);
+		total += static_cast<int64_t>(header.base) * static_cast<int64_t>(count);
+		// Padding past count decodes as 0, so the whole block can be summed.
+		if (header.width != 0)
+		{
+			total += static_cast<int64_t>(sumBlock(column.words.data() + header.offset, header.width));
+		}
+	}
+	return total;
+}
+
+const PayrollHistory::Period *PayrollHistory::find(int key) const
+{
+	auto it = lower_bound(history.begin(), history.end(), key, [](const Period &p, int k) { return p.key < k; });
+	return it != history.end() && it->key == key ? &*it : nullptr;
+}
+
+void PayrollHistory::yearRange(int year, int month, size_t &first, size_t &last) const
+{
+	auto before = [](const Period &p, int k) { return p.key < k; };
+	first = lower_bound(history.begin(), history.end(), keyOf(year, 1), before) - history.begin();
+	last = lower_bound(history.begin(), history.end(), keyOf(year, month) + 1, before) - history.begin();
+}
+
+size_t PayrollHistory::periods() const
+{
+	return history.size();
+}
+
+bool PayrollHistory::hasPeriod(int year, int month) const
+{
+	return find(keyOf(year, month)) != nullptr;
+}
+
+int64_t PayrollHistory::totalSalary(int year, int month) const
+{
+	const Period *period = find(keyOf(year, month));
+	if (period == nullptr)
+	{
+		return 0;
+	}
+	return RATES[0] * sum(period->columns[0]) + RATES[1] * sum(period->columns[1]);
+}
+
+int64_t PayrollHistory::totalUnits(EmployeeType type, int year, int month) const
+{
+	const Period *period = find(keyOf(year, month));
+	return period ? sum(period->columns[typeIndex(type)]) : 0;
+}
+
+int PayrollHistory::unitsAt(size_t row, int year, int month) const
+{
+	const Period *period = find(keyOf(year, month));
+	if (period == nullptr || row >= rowTypes.size())
+	{
+		return 0;
+	}
+	const PackedColumn &column = period->columns[typeIndex(rowTypes[row])];
+	size_t rank = rankOfRow[row];
+	return rank < column.count ? valueAt(column, rank) : 0;
+}
+
+int64_t PayrollHistory::yearToDate(size_t row, int year, int month) const
+{
+	if (row >= rowTypes.size())
+	{
+		return 0;
+	}
+	int t = typeIndex(rowTypes[row]);
+	size_t rank = rankOfRow[row];
+	size_t first, last;
+	yearRange(year, month, first, last);
+	int64_t units = 0;
+	for (size_t p = first; p < last; p++)
+	{
+		const PackedColumn &column = history[p].columns[t];
+		if (rank < column.count)
+		{
+			units += valueAt(column, rank);
+		}
+	}
+	return units * RATES[t];
+}
+
+vector<int64_t> PayrollHistory::yearToDate(int year, int month) const
+{
+	size_t first, last;
+	yearRange(year, month, first, last);
+	vector<int64_t> salaries(rowTypes.size(), 0);
+	uint32_t buffer[BLOCK];
+	vector<int64_t> units;
+	for (int t = 0; t < 2; t++)
+	{
+		const vector<uint32_t> &rows = rowsOfType[t];
+		units.assign(rows.size(), 0);
+		for (size_t p = first; p < last; p++)
+		{
+			const PackedColumn &column = history[p].columns[t];
+			for (size_t b = 0; b < column.blocks.size(); b++)
+			{
+				const BlockHeader &header = column.blocks[b];
+				int64_t base = header.base;
+				int64_t *dst = units.data() + b * BLOCK;
+				unpackBlock(column.words.data() + header.offset, header.width, buffer);
+				size_t count = column.count - b * BLOCK;
+				if (count >= BLOCK)
+				{
+					// Fixed trip count, so this loop vectorizes too.
+					for (size_t j = 0; j < BLOCK; j++)
+					{
+						dst[j] += base + buffer[j];
+					}
+				}
+				else
+				{
+					for (size_t j = 0; j < count; j++)
+					{
+						dst[j] += base + buffer[j];
+					}
+				}
+			}
+		}
+		for (size_t i = 0; i < rows.size(); i++)
+		{
+			salaries[rows[i]] = units[i] * RATES[t];
+		}
+	}
+	return salaries;
+}
+
+size_t PayrollHistory::bytesUsed() const
+{
+	size_t bytes = history.capacity() * sizeof(Period);
+	for (const Period &period : history)
+	{
+		for (const PackedColumn &column : period.columns)
+		{
+			bytes += column.blocks.capacity() * sizeof(BlockHeader) + column.words.capacity() * sizeof(uint32_t);
+		}
+	}
+	return bytes;
+}
+
+size_t PayrollHistory::rawBytes() const
+{
+	size_t values = 0;
+	for (const Period &period : history)
+	{
+		values += period.columns[0].count + period.columns[1].count;
+	}
+	return values * sizeof(int32_t);
+}
+
+const string &PayrollHistory::getError() const
+{
+	return error;
+}
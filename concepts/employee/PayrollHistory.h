@@ -0,0 +1,114 @@
+#ifndef PAYROLLHISTORY_H
+#define PAYROLLHISTORY_H
+
+#include "EmployeeColumns.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Month-by-month history of every employee's units (working days or
+// products), kept compressed so years of payroll stay small and scans
+// stay fast.
+//
+// closePeriod() copies the roster's current units as one period. Within a
+// period the units are split into an office column and a worker column,
+// each in employee order. Every column is cut into blocks of BLOCK values.
+// A block stores its minimum, and each value is stored as its distance
+// from that minimum, packed into the fewest bits that fit the block's
+// range (frame of reference + bit packing). A month of working days in
+// 0..22 therefore costs 5 bits per employee instead of 32.
+//
+// Bits are interleaved across LANES 32-bit lanes: value j of a block sits
+// in lane j % LANES. Every lane then needs the same shift and mask at each
+// step, so the unpack loop compiles to plain SIMD shifts. Queries decode
+// one block at a time into a small buffer and never expand a whole column.
+//
+// Salaries use the standard schedule (OfficeEmployee::DAILY_RATE and
+// Worker::PRODUCT_RATE). Rows must only be appended between periods, as
+// EmployeeManagement does; an employee hired later simply has no units in
+// earlier periods.
+class PayrollHistory
+{
+public:
+	static constexpr size_t LANES = 8;
+	static constexpr size_t BLOCK = 32 * LANES;
+
+	PayrollHistory();
+
+	// Records the units of every row of columns as period year/month.
+	// Periods must be closed in increasing order.
+	bool closePeriod(int year, int month, const EmployeeColumns &columns);
+
+	size_t periods() const;
+
+	bool hasPeriod(int year, int month) const;
+
+	// Payroll of one period; 0 if it was never closed.
+	int64_t totalSalary(int year, int month) const;
+
+	int64_t totalUnits(EmployeeType type, int year, int month) const;
+
+	// Units of one employee in one period; 0 if either did not exist.
+	int unitsAt(size_t row, int year, int month) const;
+
+	// Salary of one employee from January through month of year.
+	int64_t yearToDate(size_t row, int year, int month) const;
+
+	// The same for every employee at once, indexed by row.
+	std::vector<int64_t> yearToDate(int year, int month) const;
+
+	// Compressed size of the periods, and what they would take as int32
+	// arrays.
+	size_t bytesUsed() const;
+	size_t rawBytes() const;
+
+	const std::string &getError() const;
+
+private:
+	// One per block, kept together so a lookup touches one header.
+	struct BlockHeader
+	{
+		int32_t base;		 // smallest value in the block
+		uint32_t offset; // first word of the block
+		uint32_t width;	 // bits per value
+	};
+
+	struct PackedColumn
+	{
+		size_t count;
+		std::vector<BlockHeader> blocks;
+		std::vector<uint32_t> words;
+	};
+
+	struct Period
+	{
+		int key; // year * 12 + month - 1
+		PackedColumn columns[2];
+	};
+
+	static int keyOf(int year, int month);
+	static int typeIndex(EmployeeType type);
+
+	static void pack(const int32_t *values, size_t n, PackedColumn &column);
+	static void unpackBlock(const uint32_t *words, unsigned width, uint32_t *out);
+	static uint64_t sumBlock(const uint32_t *words, unsigned width);
+	static int32_t valueAt(const PackedColumn &column, size_t i);
+	static int64_t sum(const PackedColumn &column);
+
+	const Period *find(int key) const;
+
+	// Periods [first, last) of year through month.
+	void yearRange(int year, int month, size_t &first, size_t &last) const;
+
+	std::vector<Period> history;
+
+	// Rows seen so far: their type and position within their type's column.
+	std::vector<EmployeeType> rowTypes;
+	std::vector<uint32_t> rankOfRow;
+	std::vector<uint32_t> rowsOfType[2];
+
+	std::string error;
+};
+
+#endif // PAYROLLHISTORY_H
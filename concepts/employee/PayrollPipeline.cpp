@@ -0,0 +1,216 @@
+#include "PayrollPipeline.h"
+#include "BufferedWriter.h"
+#include "MappedFile.h"
+#include "RosterLoader.h"
+#include "SpscQueue.h"
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+	typedef chrono::steady_clock Clock;
+
+	struct SplitLine
+	{
+		string_view fields[4];
+		bool complete;
+	};
+
+	struct PayrollLine
+	{
+		RosterRow row;
+		int64_t salary;
+	};
+
+	double msSince(Clock::time_point start)
+	{
+		return chrono::duration<double, milli>(Clock::now() - start).count();
+	}
+
+	void parseStage(string_view text, char delimiter, SpscQueue<vector<SplitLine>> &output, double &busyMs)
+	{
+		const char *p = text.data();
+		const char *end = p + text.size();
+		while (p < end)
+		{
+			Clock::time_point start = Clock::now();
+			vector<SplitLine> batch;
+			batch.reserve(PayrollPipeline::BATCH_ROWS);
+			while (p < end && batch.size() < PayrollPipeline::BATCH_ROWS)
+			{
+				const char *nl = static_cast<const char *>(memchr(p, '\n', end - p));
+				const char *lineEnd = nl ? nl : end;
+				string_view line = RosterLoader::trimLine(string_view(p, lineEnd - p));
+				p = lineEnd + 1;
+				if (line.empty())
+				{
+					continue;
+				}
+				batch.emplace_back();
+				batch.back().complete = RosterLoader::splitLine(line, delimiter, batch.back().fields);
+			}
+			busyMs += msSince(start);
+			if (!batch.empty())
+			{
+				output.push(move(batch));
+			}
+		}
+		output.close();
+	}
+
+	void validateStage(SpscQueue<vector<SplitLine>> &input, SpscQueue<vector<RosterRow>> &output,
+										 size_t &rejected, double &busyMs)
+	{
+		bool firstLineSeen = false;
+		vector<SplitLine> batch;
+		while (input.pop(batch))
+		{
+			Clock::time_point start = Clock::now();
+			vector<RosterRow> valid;
+			valid.reserve(batch.size());
+			for (const SplitLine &line : batch)
+			{
+				RosterRow row;
+				if (line.complete && RosterLoader::parseFields(line.fields, row))
+				{
+					valid.push_back(row);
+				}
+				else if (firstLineSeen)
+				{
+					rejected++;
+				}
+				// A malformed first line is taken to be a header.
+				firstLineSeen = true;
+			}
+			busyMs += msSince(start);
+			output.push(move(valid));
+		}
+		output.close();
+	}
+
+	void computeStage(SpscQueue<vector<RosterRow>> &input, SpscQueue<vector<PayrollLine>> &output,
+										const PayPolicy &policy, size_t &rows, int64_t &total, double &busyMs)
+	{
+		vector<RosterRow> batch;
+		while (input.pop(batch))
+		{
+			Clock::time_point start = Clock::now();
+			vector<PayrollLine> lines(batch.size());
+			for (size_t i = 0; i < batch.size(); i++)
+			{
+				lines[i].row = batch[i];
+				lines[i].salary = policy.salaryOf(batch[i].type, batch[i].units);
+				total += lines[i].salary;
+			}
+			rows += batch.size();
+			busyMs += msSince(start);
+			output.push(move(lines));
+		}
+		output.close();
+	}
+
+	void emitStage(SpscQueue<vector<PayrollLine>> &input, ostream &out, char delimiter, double &busyMs)
+	{
+		BufferedWriter writer(out);
+		writer.append("type");
+		writer.append(delimiter);
+		writer.append("name");
+		writer.append(delimiter);
+		writer.append("birthDate");
+		writer.append(delimiter);
+		writer.append("units");
+		writer.append(delimiter);
+		writer.append("salary");
+		writer.append('\n');
+
+		vector<PayrollLine> batch;
+		while (input.pop(batch))
+		{
+			Clock::time_point start = Clock::now();
+			for (const PayrollLine &line : batch)
+			{
+				writer.append(line.row.type == EmployeeType::Office ? "office" : "worker");
+				writer.append(delimiter);
+				writer.append(line.row.name);
+				writer.append(delimiter);
+				writer.append(line.row.birthDate);
+				writer.append(delimiter);
+				writer.appendInt(line.row.units);
+				writer.append(delimiter);
+				writer.appendInt(line.salary);
+				writer.append('\n');
+				writer.flushIfFull();
+			}
+			busyMs += msSince(start);
+		}
+		Clock::time_point start = Clock::now();
+		writer.flush();
+		busyMs += msSince(start);
+	}
+}
+
+const char *PipelineStats::stageName(int stage)
+{
+	static const char *names[STAGES] = {"parse", "validate", "compute", "emit"};
+	return names[stage];
+}
+
+PayrollPipeline::PayrollPipeline(ostream &out, const PayPolicy &policy) : out(out), policy(policy)
+{
+	stats = PipelineStats();
+}
+
+bool PayrollPipeline::run(const string &path)
+{
+	MappedFile file;
+	error.clear();
+	if (!file.open(path, true, error))
+	{
+		return false;
+	}
+	run(string_view(file.data(), file.size()));
+	return true;
+}
+
+void PayrollPipeline::run(string_view text)
+{
+	stats = PipelineStats();
+	Clock::time_point start = Clock::now();
+	char delimiter = text.empty() ? ',' : RosterLoader::detectDelimiter(text.data(), text.size());
+
+	SpscQueue<vector<SplitLine>> lines(QUEUE_BATCHES);
+	SpscQueue<vector<RosterRow>> rows(QUEUE_BATCHES);
+	SpscQueue<vector<PayrollLine>> results(QUEUE_BATCHES);
+
+	thread parser(parseStage, text, delimiter, ref(lines), ref(stats.busyMs[PipelineStats::PARSE]));
+	thread validator(validateStage, ref(lines), ref(rows), ref(stats.rejected),
+									 ref(stats.busyMs[PipelineStats::VALIDATE]));
+	thread calculator(computeStage, ref(rows), ref(results), cref(policy), ref(stats.rows), ref(stats.totalSalary),
+										ref(stats.busyMs[PipelineStats::COMPUTE]));
+	emitStage(results, out, delimiter, stats.busyMs[PipelineStats::EMIT]);
+	parser.join();
+	validator.join();
+	calculator.join();
+
+	stats.elapsedMs = msSince(start);
+	stats.fullWaits[PipelineStats::PARSE] = lines.getFullWaits();
+	stats.fullWaits[PipelineStats::VALIDATE] = rows.getFullWaits();
+	stats.fullWaits[PipelineStats::COMPUTE] = results.getFullWaits();
+	stats.emptyWaits[PipelineStats::VALIDATE] = lines.getEmptyWaits();
+	stats.emptyWaits[PipelineStats::COMPUTE] = rows.getEmptyWaits();
+	stats.emptyWaits[PipelineStats::EMIT] = results.getEmptyWaits();
+}
+
+const PipelineStats &PayrollPipeline::getStats() const
+{
+	return stats;
+}
+
+const string &PayrollPipeline::getError() const
+{
+	return error;
+}
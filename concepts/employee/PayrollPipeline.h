@@ -0,0 +1,72 @@
+#ifndef PAYROLLPIPELINE_H
+#define PAYROLLPIPELINE_H
+
+#include "PayPolicy.h"
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+struct PipelineStats
+{
+	enum Stage
+	{
+		PARSE,
+		VALIDATE,
+		COMPUTE,
+		EMIT,
+		STAGES
+	};
+
+	static const char *stageName(int stage);
+
+	size_t rows;
+	size_t rejected; // malformed lines, not counting a header
+	int64_t totalSalary;
+	double elapsedMs;
+
+	// Time each stage spent working, i.e. not waiting on its queues, and how
+	// often it found its output queue full (backpressure) or its input empty.
+	double busyMs[STAGES];
+	size_t fullWaits[STAGES];
+	size_t emptyWaits[STAGES];
+};
+
+// A payroll run from a CSV/TSV roster (the RosterLoader format) to a
+// payroll CSV of type,name,birthDate,units,salary, as four stages on
+// their own threads:
+//
+//   parse     cut the text into lines and fields
+//   validate  check the fields as importFile() does (RosterLoader::parseFields)
+//   compute   salary of every row under the pay policy, running total
+//   emit      format the results and write them out
+//
+// Stages hand batches of BATCH_ROWS rows to each other through bounded
+// SpscQueues of QUEUE_BATCHES batches, so the stages overlap and a slow
+// stage holds back the ones before it. Output is in input order.
+class PayrollPipeline
+{
+public:
+	static const size_t BATCH_ROWS = 1024;
+	static const size_t QUEUE_BATCHES = 16;
+
+	explicit PayrollPipeline(std::ostream &out, const PayPolicy &policy = PayPolicy::standard());
+
+	// Returns false (see getError()) if the file cannot be read.
+	bool run(const std::string &path);
+
+	void run(std::string_view text);
+
+	const PipelineStats &getStats() const;
+
+	const std::string &getError() const;
+
+private:
+	std::ostream &out;
+	const PayPolicy &policy;
+	PipelineStats stats;
+	std::string error;
+};
+
+#endif // PAYROLLPIPELINE_H
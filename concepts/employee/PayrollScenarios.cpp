@@ -0,0 +1,184 @@
+#include "PayrollScenarios.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+namespace
+{
+	// Payroll of n employees of one type under pay, in the same int64
+	// arithmetic as evaluate(), for any units and rates.
+	int64_t sumPayExact(const int32_t *units, size_t n, const ScenarioPay &pay)
+	{
+		const int64_t extra = static_cast<int64_t>(pay.overtimeRate) - pay.rate;
+		int64_t total = 0;
+		for (size_t i = 0; i < n; i++)
+		{
+			int64_t u = units[i];
+			int64_t over = u - pay.overtimeFrom;
+			int64_t salary = pay.rate * u + extra * (over > 0 ? over : 0);
+			total += salary > pay.minimumPay ? salary : pay.minimumPay;
+		}
+		return total;
+	}
+
+	// The same in doubles. Eight independent accumulators and no branches,
+	// so the inner loop vectorizes, which the int64 one does not. Exact only
+	// while fitsDouble().
+	int64_t sumPayDouble(const int32_t *units, size_t n, const ScenarioPay &pay)
+	{
+		const double rate = pay.rate;
+		const double extra = static_cast<double>(pay.overtimeRate) - pay.rate;
+		const double from = pay.overtimeFrom;
+		const double floor = static_cast<double>(pay.minimumPay);
+		double acc[8] = {};
+		size_t i = 0;
+		for (; i + 8 <= n; i += 8)
+		{
+			for (size_t k = 0; k < 8; k++)
+			{
+				double u = units[i + k];
+				double over = u - from;
+				double salary = rate * u + extra * (over > 0 ? over : 0);
+				acc[k] += salary > floor ? salary : floor;
+			}
+		}
+		for (; i < n; i++)
+		{
+			double u = units[i];
+			double over = u - from;
+			double salary = rate * u + extra * (over > 0 ? over : 0);
+			acc[0] += salary > floor ? salary : floor;
+		}
+		double total = 0;
+		for (double a : acc)
+		{
+			total += a;
+		}
+		return static_cast<int64_t>(total);
+	}
+
+	// Whether n salaries under pay, with |units| <= maxUnits, and every sum
+	// of them stay below 2^53, where doubles add whole numbers exactly. The
+	// bound is itself computed in doubles, hence the factor of two margin.
+	bool fitsDouble(size_t n, int64_t maxUnits, const ScenarioPay &pay)
+	{
+		double units = static_cast<double>(maxUnits);
+		double extra = fabs(static_cast<double>(pay.overtimeRate) - pay.rate);
+		double over = max(0.0, units - pay.overtimeFrom);
+		double salary = max(fabs(static_cast<double>(pay.rate)) * units + extra * over,
+												fabs(static_cast<double>(pay.minimumPay)));
+		return salary * static_cast<double>(n) < 0x1p52;
+	}
+
+	// Summed exactly for any inputs; in doubles when that is exact too.
+	int64_t sumPay(const int32_t *units, size_t n, int64_t maxUnits, const ScenarioPay &pay)
+	{
+		return fitsDouble(n, maxUnits, pay) ? sumPayDouble(units, n, pay) : sumPayExact(units, n, pay);
+	}
+
+	// Splits units[first, last) by type into contiguous arrays. Returns the
+	// largest |units| among them.
+	int64_t splitByType(const EmployeeColumns &columns, size_t first, size_t last, vector<int32_t> &office,
+											vector<int32_t> &worker)
+	{
+		const EmployeeType *types = columns.types();
+		const int32_t *units = columns.units();
+		office.clear();
+		worker.clear();
+		int64_t maxUnits = 0;
+		for (size_t i = first; i < last; i++)
+		{
+			int64_t u = units[i];
+			(types[i] == EmployeeType::Office ? office : worker).push_back(units[i]);
+			maxUnits = max(maxUnits, u < 0 ? -u : u);
+		}
+		return maxUnits;
+	}
+}
+
+PayrollScenarios::PayrollScenarios(unsigned threads) : parallel(threads)
+{
+}
+
+void PayrollScenarios::add(const PayrollScenario &scenario)
+{
+	scenarios.push_back(scenario);
+}
+
+size_t PayrollScenarios::size() const
+{
+	return scenarios.size();
+}
+
+const PayrollScenario &PayrollScenarios::at(size_t i) const
+{
+	return scenarios[i];
+}
+
+unsigned PayrollScenarios::getThreads() const
+{
+	return parallel.getThreads();
+}
+
+vector<ScenarioResult> PayrollScenarios::run(const EmployeeColumns &columns) const
+{
+	size_t rows = columns.size();
+	size_t count = scenarios.size();
+	size_t blocks = ParallelPayroll::blockCount(rows);
+
+	// partials[(block * count + s) * 2 + type]: written by one block only.
+	vector<int64_t> partials(blocks * count * 2);
+	parallel.forEachBlock(rows, [&](size_t block, size_t first, size_t last) {
+		vector<int32_t> office, worker;
+		office.reserve(last - first);
+		worker.reserve(last - first);
+		int64_t maxUnits = splitByType(columns, first, last, office, worker);
+		int64_t *out = partials.data() + block * count * 2;
+		for (size_t s = 0; s < count; s++)
+		{
+			out[2 * s] = sumPay(office.data(), office.size(), maxUnits, scenarios[s].office);
+			out[2 * s + 1] = sumPay(worker.data(), worker.size(), maxUnits, scenarios[s].worker);
+		}
+	});
+
+	vector<ScenarioResult> results(count);
+	for (size_t s = 0; s < count; s++)
+	{
+		int64_t officePay = 0;
+		int64_t workerPay = 0;
+		for (size_t b = 0; b < blocks; b++)
+		{
+			officePay += partials[(b * count + s) * 2];
+			workerPay += partials[(b * count + s) * 2 + 1];
+		}
+		results[s] = finish(scenarios[s], officePay, workerPay);
+	}
+	return results;
+}
+
+ScenarioResult PayrollScenarios::evaluate(const PayrollScenario &scenario, const EmployeeColumns &columns)
+{
+	const EmployeeType *types = columns.types();
+	const int32_t *units = columns.units();
+	int64_t pay[2] = {0, 0};
+	for (size_t i = 0; i < columns.size(); i++)
+	{
+		bool isOffice = types[i] == EmployeeType::Office;
+		const ScenarioPay &p = isOffice ? scenario.office : scenario.worker;
+		int64_t u = units[i];
+		int64_t over = u - p.overtimeFrom;
+		int64_t salary = p.rate * u + (static_cast<int64_t>(p.overtimeRate) - p.rate) * (over > 0 ? over : 0);
+		pay[isOffice ? 0 : 1] += salary > p.minimumPay ? salary : p.minimumPay;
+	}
+	return finish(scenario, pay[0], pay[1]);
+}
+
+ScenarioResult PayrollScenarios::finish(const PayrollScenario &scenario, int64_t officePay, int64_t workerPay)
+{
+	ScenarioResult result;
+	result.officePay = officePay;
+	result.workerPay = workerPay;
+	result.totalSalary = officePay * scenario.office.headcount + workerPay * scenario.worker.headcount;
+	return result;
+}
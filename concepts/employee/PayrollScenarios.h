@@ -0,0 +1,84 @@
+#ifndef PAYROLLSCENARIOS_H
+#define PAYROLLSCENARIOS_H
+
+#include "EmployeeColumns.h"
+#include "OfficeEmployee.h"
+#include "ParallelPayroll.h"
+#include "Worker.h"
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// How one employee type is paid in a what-if scenario:
+//   salary = rate * units, with units above overtimeFrom paid overtimeRate
+//            instead, and never less than minimumPay
+// The type's payroll is then scaled by headcount (1.1 = 10% more staff
+// with the same spread of units).
+struct ScenarioPay
+{
+	int rate;
+	int overtimeFrom = INT_MAX;
+	int overtimeRate = 0;
+	int64_t minimumPay = 0;
+	double headcount = 1.0;
+};
+
+struct PayrollScenario
+{
+	std::string name;
+	ScenarioPay office{OfficeEmployee::DAILY_RATE};
+	ScenarioPay worker{Worker::PRODUCT_RATE};
+};
+
+struct ScenarioResult
+{
+	int64_t officePay; // before headcount scaling
+	int64_t workerPay;
+	double totalSalary;
+};
+
+// Evaluates many what-if pay scenarios against the roster in one sweep.
+//
+// The roster is cut into ParallelPayroll blocks and the blocks are spread
+// over the threads. Each block's units are split by type once, into two
+// small arrays that stay in cache, and then every scenario is run over
+// them before the next block is touched. Hundreds of scenarios therefore
+// cost one pass over memory rather than hundreds; the per-scenario kernel
+// is branch-free arithmetic over contiguous units and vectorizes.
+//
+// Salaries are whole currency units and are summed exactly, in the same
+// int64 arithmetic as evaluate(), so results do not depend on the thread
+// count. The vectorized kernel works in doubles and only runs on blocks
+// whose payroll provably stays below 2^53; others take a scalar int64
+// loop.
+class PayrollScenarios
+{
+public:
+	// threads == 0 uses std::thread::hardware_concurrency().
+	explicit PayrollScenarios(unsigned threads = 0);
+
+	void add(const PayrollScenario &scenario);
+
+	size_t size() const;
+
+	const PayrollScenario &at(size_t i) const;
+
+	// One result per scenario, in the order they were added.
+	std::vector<ScenarioResult> run(const EmployeeColumns &columns) const;
+
+	// The same for a single scenario with its own pass over the roster;
+	// the baseline run() is measured against.
+	static ScenarioResult evaluate(const PayrollScenario &scenario, const EmployeeColumns &columns);
+
+	unsigned getThreads() const;
+
+private:
+	static ScenarioResult finish(const PayrollScenario &scenario, int64_t officePay, int64_t workerPay);
+
+	std::vector<PayrollScenario> scenarios;
+	ParallelPayroll parallel;
+};
+
+#endif // PAYROLLSCENARIOS_H
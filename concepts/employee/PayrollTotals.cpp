@@ -0,0 +1,72 @@
+#include "PayrollTotals.h"
+#include "OfficeEmployee.h"
+#include "Worker.h"
+
+PayrollTotals::PayrollTotals()
+		: officeCount(0), workerCount(0), officeUnits(0), workerUnits(0)
+{
+}
+
+void PayrollTotals::add(EmployeeType type, int units)
+{
+	if (type == EmployeeType::Office)
+	{
+		officeCount++;
+		officeUnits += units;
+	}
+	else
+	{
+		workerCount++;
+		workerUnits += units;
+	}
+}
+
+void PayrollTotals::update(EmployeeType type, int oldUnits, int newUnits)
+{
+	int64_t delta = static_cast<int64_t>(newUnits) - oldUnits;
+	if (type == EmployeeType::Office)
+	{
+		officeUnits += delta;
+	}
+	else
+	{
+		workerUnits += delta;
+	}
+}
+
+void PayrollTotals::clear()
+{
+	officeCount = 0;
+	workerCount = 0;
+	officeUnits = 0;
+	workerUnits = 0;
+}
+
+size_t PayrollTotals::count() const
+{
+	return officeCount + workerCount;
+}
+
+size_t PayrollTotals::count(EmployeeType type) const
+{
+	return type == EmployeeType::Office ? officeCount : workerCount;
+}
+
+int64_t PayrollTotals::units(EmployeeType type) const
+{
+	return type == EmployeeType::Office ? officeUnits : workerUnits;
+}
+
+double PayrollTotals::totalSalary() const
+{
+	return static_cast<double>(officeUnits * OfficeEmployee::DAILY_RATE + workerUnits * Worker::PRODUCT_RATE);
+}
+
+double PayrollTotals::totalSalary(EmployeeType type) const
+{
+	if (type == EmployeeType::Office)
+	{
+		return static_cast<double>(officeUnits * OfficeEmployee::DAILY_RATE);
+	}
+	return static_cast<double>(workerUnits * Worker::PRODUCT_RATE);
+}
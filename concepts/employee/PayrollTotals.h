@@ -0,0 +1,36 @@
+#ifndef PAYROLLTOTALS_H
+#define PAYROLLTOTALS_H
+
+#include "Employee.h"
+#include <cstddef>
+#include <cstdint>
+
+// Running payroll aggregates, updated in O(1) per roster mutation so that
+// total and per-type queries never rescan the roster.
+class PayrollTotals
+{
+public:
+	PayrollTotals();
+
+	void add(EmployeeType type, int units);
+
+	void update(EmployeeType type, int oldUnits, int newUnits);
+
+	void clear();
+
+	size_t count() const;
+	size_t count(EmployeeType type) const;
+
+	int64_t units(EmployeeType type) const;
+
+	double totalSalary() const;
+	double totalSalary(EmployeeType type) const;
+
+private:
+	size_t officeCount;
+	size_t workerCount;
+	int64_t officeUnits;
+	int64_t workerUnits;
+};
+
+#endif // PAYROLLTOTALS_H
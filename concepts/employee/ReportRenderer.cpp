@@ -0,0 +1,161 @@
+#include "ReportRenderer.h"
+#include "ConcurrentEmployeeManagement.h"
+#include "Instrumentation.h"
+#include "StringPool.h"
+
+using namespace std;
+
+ReportRenderer::ReportRenderer(ostream &out) : writer(out)
+{
+}
+
+void ReportRenderer::renderAll(const EmployeeColumns &columns)
+{
+	renderRange(columns, 0, columns.size());
+}
+
+void ReportRenderer::renderPage(const EmployeeColumns &columns, size_t page, size_t pageSize)
+{
+	renderRange(columns, page * pageSize, page * pageSize + pageSize);
+}
+
+void ReportRenderer::renderRange(const EmployeeColumns &columns, size_t first, size_t last)
+{
+	if (!beginRange(columns.size(), first, last))
+	{
+		return;
+	}
+	for (size_t i = first; i < last; i++)
+	{
+		appendRecord(i, columns.typeAt(i), columns.nameAt(i), columns.birthDateAt(i),
+								 columns.salaryAt(i), columns.unitsAt(i));
+		writer.flushIfFull();
+	}
+	endRange();
+}
+
+void ReportRenderer::renderAll(const ConcurrentEmployeeManagement &roster)
+{
+	ConcurrentEmployeeManagement::Snapshot snapshot = roster.snapshot();
+	size_t last = snapshot.size();
+	if (!beginRange(last, 0, last))
+	{
+		return;
+	}
+	StringPool &pool = StringPool::shared();
+	char dateBuffer[10];
+	size_t i = 0;
+	snapshot.forEach([&](const EmployeeRecord &r) {
+		appendRecord(i++, r.type, pool.view(r.nameId), r.birthDateText(dateBuffer), r.salary(), r.units);
+		writer.flushIfFull();
+	});
+	endRange();
+}
+
+void ReportRenderer::renderRows(const EmployeeColumns &columns, const vector<size_t> &rows)
+{
+	if (rows.empty())
+	{
+		appendEmpty();
+		return;
+	}
+
+	writer.append("\n");
+	writer.append("========================================\n");
+	writer.append("         MATCHING EMPLOYEES (");
+	writer.appendInt(static_cast<long long>(rows.size()));
+	writer.append(")\n");
+	writer.append("========================================\n");
+	for (size_t i : rows)
+	{
+		appendRecord(i, columns.typeAt(i), columns.nameAt(i), columns.birthDateAt(i),
+								 columns.salaryAt(i), columns.unitsAt(i));
+		writer.flushIfFull();
+	}
+	endRange();
+}
+
+bool ReportRenderer::beginRange(size_t n, size_t first, size_t &last)
+{
+	if (last > n)
+	{
+		last = n;
+	}
+	if (first >= last)
+	{
+		appendEmpty();
+		return false;
+	}
+
+	writer.append("\n");
+	writer.append("========================================\n");
+	if (first == 0 && last == n)
+	{
+		writer.append("         ALL EMPLOYEES (");
+		writer.appendInt(static_cast<long long>(n));
+		writer.append(")\n");
+	}
+	else
+	{
+		writer.append("         EMPLOYEES ");
+		writer.appendInt(static_cast<long long>(first + 1));
+		writer.append("-");
+		writer.appendInt(static_cast<long long>(last));
+		writer.append(" OF ");
+		writer.appendInt(static_cast<long long>(n));
+		writer.append("\n");
+	}
+	writer.append("========================================\n");
+	return true;
+}
+
+void ReportRenderer::appendEmpty()
+{
+	writer.append("\n");
+	writer.append("  +-----------------------------+\n");
+	writer.append("  |    No employees to show     |\n");
+	writer.append("  +-----------------------------+\n");
+	writer.flush();
+}
+
+void ReportRenderer::endRange()
+{
+	writer.append("\n========================================\n");
+	writer.append("          End of List\n");
+	writer.append("========================================\n");
+	writer.flush();
+}
+
+void ReportRenderer::appendRecord(size_t i, EmployeeType type, string_view name, string_view birthDate,
+																	double salary, int units)
+{
+	// The report's describe(): displayAll() formats here, not through Employee.
+	EMPLOYEE_TIMED_SCOPE(timer, "ReportRenderer::describe");
+	bool office = type == EmployeeType::Office;
+
+	writer.append("\n  --- Employee #");
+	writer.appendInt(static_cast<long long>(i + 1));
+	writer.append(" ---\n");
+	writer.append("  +-----------------------------+\n");
+	writer.append(office ? "  |      OFFICE EMPLOYEE        |\n" : "  |          WORKER             |\n");
+	writer.append("  +-----------------------------+\n");
+	writer.append("  | Name:        ");
+	writer.append(name);
+	writer.append("\n  | Birth Date:  ");
+	writer.append(birthDate);
+	writer.append("\n  | Salary:      $");
+	writer.appendDouble(salary);
+	writer.append(office ? "\n  | Working Days: " : "\n  | Products:    ");
+	writer.appendInt(units);
+	writer.append("\n  +-----------------------------+\n");
+}
+
+void ReportRenderer::flush()
+{
+	writer.flush();
+}
+
+size_t ReportRenderer::getBytesWritten() const
+{
+	return writer.getBytesWritten();
+}
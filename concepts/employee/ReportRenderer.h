@@ -0,0 +1,51 @@
+#ifndef REPORTRENDERER_H
+#define REPORTRENDERER_H
+
+#include "BufferedWriter.h"
+#include "EmployeeColumns.h"
+#include <cstddef>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+class ConcurrentEmployeeManagement;
+
+// Renders the employee report straight from EmployeeColumns through a
+// BufferedWriter, instead of a dozen operator<< calls per employee. The
+// output is identical to Employee::describe(). Rows come from
+// EmployeeColumns or from a ConcurrentEmployeeManagement snapshot.
+class ReportRenderer
+{
+public:
+	explicit ReportRenderer(std::ostream &out);
+
+	// Rows [first, last), clamped to the roster, between the usual banners.
+	void renderRange(const EmployeeColumns &columns, size_t first, size_t last);
+
+	// The given 0-based rows, in order, under a "MATCHING EMPLOYEES" banner.
+	void renderRows(const EmployeeColumns &columns, const std::vector<size_t> &rows);
+
+	// Zero-based page of pageSize rows.
+	void renderPage(const EmployeeColumns &columns, size_t page, size_t pageSize);
+
+	void renderAll(const EmployeeColumns &columns);
+
+	// One snapshot of roster, taken now.
+	void renderAll(const ConcurrentEmployeeManagement &roster);
+
+	void flush();
+
+	size_t getBytesWritten() const;
+
+private:
+	// Writes the banner; returns false (after the empty notice) if there is nothing to show.
+	bool beginRange(size_t n, size_t first, size_t &last);
+	void endRange();
+	void appendEmpty();
+	void appendRecord(size_t i, EmployeeType type, std::string_view name, std::string_view birthDate,
+										double salary, int units);
+
+	BufferedWriter writer;
+};
+
+#endif // REPORTRENDERER_H
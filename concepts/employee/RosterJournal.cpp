@@ -0,0 +1,579 @@
+#include "RosterJournal.h"
+#include "FileSync.h"
+#include "MappedFile.h"
+#include "RosterSnapshot.h"
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+
+using namespace std;
+
+namespace
+{
+	const char MAGIC[8] = {'E', 'M', 'P', 'J', 'R', 'N', 'L', '\0'};
+
+	enum : uint8_t
+	{
+		OP_ADD = 1,
+		OP_SET_UNITS = 2
+	};
+
+	struct FileHeader
+	{
+		char magic[8];
+		uint32_t version;
+		uint32_t reserved;
+	};
+
+	// Every record is a RecordHeader followed by `length` body bytes. The
+	// checksum covers the body and is filled in by the flusher, not by the
+	// thread doing the mutation.
+	struct RecordHeader
+	{
+		uint32_t length;
+		uint32_t checksum;
+	};
+
+	// Body of OP_ADD, followed by the name and birth date bytes.
+	struct AddBody
+	{
+		uint8_t op;
+		uint8_t type;
+		uint16_t reserved;
+		int32_t units;
+		uint64_t row;
+		uint32_t nameLength;
+		uint32_t birthDateLength;
+	};
+
+	struct SetUnitsBody
+	{
+		uint8_t op;
+		uint8_t reserved[3];
+		int32_t units;
+		uint64_t row;
+	};
+
+	uint32_t checksumOf(const char *p, size_t n)
+	{
+		uint32_t h = 2166136261u;
+		for (size_t i = 0; i < n; i++)
+		{
+			h = (h ^ static_cast<unsigned char>(p[i])) * 16777619u;
+		}
+		return h;
+	}
+}
+
+RosterJournal::RosterJournal(const string &basePath, const Options &options)
+		: basePath(basePath), options(options), file(nullptr), rotationRequested(false), rotationOffset(0),
+			appendedBytes(0), durableBytes(0), commitRequested(false), compacting(false), stopping(false), records(0),
+			sinceCompaction(0), replayedRecords(0), discardedBytes(0), groupWrites(0), compactions(0)
+{
+	pending.reserve(options.groupBytes * 2);
+}
+
+RosterJournal::~RosterJournal()
+{
+	if (flusher.joinable())
+	{
+		{
+			lock_guard<mutex> guard(lock);
+			stopping = true;
+		}
+		wake.notify_one();
+		flusher.join();
+	}
+	if (compactor.joinable())
+	{
+		compactor.join();
+	}
+	if (file != nullptr)
+	{
+		fclose(file);
+	}
+}
+
+string RosterJournal::getSnapshotPath() const
+{
+	return basePath + ".snap";
+}
+
+string RosterJournal::getJournalPath() const
+{
+	return basePath + ".journal";
+}
+
+bool RosterJournal::open(size_t snapshotRows, const AddFn &add, const SetUnitsFn &setUnits)
+{
+	ReplayState state{snapshotRows, add, setUnits};
+	string oldPath = getJournalPath() + ".old";
+	bool interrupted = filesystem::exists(oldPath);
+	if (interrupted && !replayFile(oldPath, false, state, replayedRecords, error))
+	{
+		return false;
+	}
+	size_t retiredRecords = replayedRecords;
+	if (filesystem::exists(getJournalPath()))
+	{
+		if (!replayFile(getJournalPath(), true, state, replayedRecords, error))
+		{
+			return false;
+		}
+		if (file == nullptr)
+		{
+			file = fopen(getJournalPath().c_str(), "ab");
+		}
+		if (file == nullptr)
+		{
+			error = "cannot append to " + getJournalPath();
+			return false;
+		}
+	}
+	else if (!createJournal(error))
+	{
+		return false;
+	}
+
+	// A crash interrupted the last compaction: finish it in the background.
+	// The live journal counts toward the next one, so a long replay is due
+	// straight away.
+	if (interrupted)
+	{
+		compacting = true;
+		compactor = thread(&RosterJournal::compactRetired, this);
+	}
+	sinceCompaction = replayedRecords - retiredRecords;
+	flusher = thread(&RosterJournal::flushLoop, this);
+	return true;
+}
+
+bool RosterJournal::replayFile(const string &path, bool live, ReplayState &state, size_t &replayed, string &message)
+{
+	MappedFile mapped;
+	if (!mapped.open(path, true, message))
+	{
+		return false;
+	}
+	const char *data = mapped.data();
+	size_t length = mapped.size();
+	if (length < sizeof(FileHeader))
+	{
+		// Only the live journal can be cut short, and only by a crash
+		// while it was being created.
+		if (!live)
+		{
+			message = path + " is truncated";
+			return false;
+		}
+		discardedBytes += length;
+		mapped.close();
+		return createJournal(message);
+	}
+	FileHeader header;
+	memcpy(&header, data, sizeof(header));
+	if (memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION)
+	{
+		message = path + " is not a roster journal";
+		return false;
+	}
+
+	size_t at = sizeof(FileHeader);
+	while (at < length)
+	{
+		RecordHeader rh;
+		if (length - at < sizeof(rh))
+		{
+			break;
+		}
+		memcpy(&rh, data + at, sizeof(rh));
+		const char *body = data + at + sizeof(rh);
+		if (length - at - sizeof(rh) < rh.length || rh.length == 0 || checksumOf(body, rh.length) != rh.checksum)
+		{
+			break;
+		}
+
+		bool ok = false;
+		if (body[0] == OP_ADD && rh.length >= sizeof(AddBody))
+		{
+			AddBody b;
+			memcpy(&b, body, sizeof(b));
+			ok = rh.length == sizeof(b) + static_cast<uint64_t>(b.nameLength) + b.birthDateLength && b.row <= state.rows;
+			if (ok && b.row == state.rows)
+			{
+				const char *strings = body + sizeof(b);
+				state.add(static_cast<EmployeeType>(b.type), string_view(strings, b.nameLength),
+									string_view(strings + b.nameLength, b.birthDateLength), b.units);
+				state.rows++;
+			}
+		}
+		else if (body[0] == OP_SET_UNITS && rh.length == sizeof(SetUnitsBody))
+		{
+			SetUnitsBody b;
+			memcpy(&b, body, sizeof(b));
+			ok = b.row < state.rows;
+			if (ok)
+			{
+				state.setUnits(static_cast<size_t>(b.row), b.units);
+			}
+		}
+		if (!ok)
+		{
+			message = path + " has a record that does not fit the roster at byte " + to_string(at);
+			return false;
+		}
+		replayed++;
+		at += sizeof(rh) + rh.length;
+	}
+
+	if (at == length)
+	{
+		return true;
+	}
+	if (!live)
+	{
+		message = path + " is corrupt at byte " + to_string(at);
+		return false;
+	}
+	// Torn tail of the live journal: cut it off so new records follow the
+	// last good one.
+	discardedBytes += length - at;
+	mapped.close();
+	error_code ec;
+	filesystem::resize_file(path, at, ec);
+	if (ec)
+	{
+		message = "cannot truncate " + path + ": " + ec.message();
+		return false;
+	}
+	return true;
+}
+
+bool RosterJournal::createJournal(string &message)
+{
+	string path = getJournalPath();
+	file = fopen(path.c_str(), "wb");
+	if (file == nullptr)
+	{
+		message = "cannot create " + path;
+		return false;
+	}
+	FileHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, MAGIC, sizeof(MAGIC));
+	header.version = VERSION;
+	if (fwrite(&header, sizeof(header), 1, file) != 1 || !FileSync::syncFile(file))
+	{
+		message = "cannot write " + path;
+		return false;
+	}
+	return true;
+}
+
+void RosterJournal::logAdd(size_t row, EmployeeType type, string_view name, string_view birthDate, int units)
+{
+	AddBody b;
+	b.op = OP_ADD;
+	b.type = static_cast<uint8_t>(type);
+	b.reserved = 0;
+	b.units = units;
+	b.row = row;
+	b.nameLength = static_cast<uint32_t>(name.size());
+	b.birthDateLength = static_cast<uint32_t>(birthDate.size());
+	RecordHeader rh{static_cast<uint32_t>(sizeof(b) + name.size() + birthDate.size()), 0};
+
+	bool full;
+	{
+		lock_guard<mutex> guard(lock);
+		const char *p = reinterpret_cast<const char *>(&rh);
+		pending.insert(pending.end(), p, p + sizeof(rh));
+		p = reinterpret_cast<const char *>(&b);
+		pending.insert(pending.end(), p, p + sizeof(b));
+		pending.insert(pending.end(), name.begin(), name.end());
+		pending.insert(pending.end(), birthDate.begin(), birthDate.end());
+		appendedBytes += sizeof(rh) + rh.length;
+		full = pending.size() >= options.groupBytes;
+	}
+	if (full)
+	{
+		wake.notify_one();
+	}
+	records++;
+	sinceCompaction++;
+}
+
+void RosterJournal::logSetUnits(size_t row, int units)
+{
+	struct
+	{
+		RecordHeader rh;
+		SetUnitsBody b;
+	} r;
+	memset(&r, 0, sizeof(r));
+	r.rh.length = sizeof(r.b);
+	r.b.op = OP_SET_UNITS;
+	r.b.units = units;
+	r.b.row = row;
+	append(&r, sizeof(r));
+	records++;
+	sinceCompaction++;
+}
+
+void RosterJournal::append(const void *data, size_t n)
+{
+	const char *p = static_cast<const char *>(data);
+	bool full;
+	{
+		lock_guard<mutex> guard(lock);
+		pending.insert(pending.end(), p, p + n);
+		appendedBytes += n;
+		full = pending.size() >= options.groupBytes;
+	}
+	if (full)
+	{
+		wake.notify_one();
+	}
+}
+
+void RosterJournal::compact()
+{
+	// Only the rotation point is recorded here. The flusher writes the
+	// records buffered so far to the journal being retired and everything
+	// logged after this point to the new one; the compactor rebuilds the
+	// roster from the files.
+	sinceCompaction = 0;
+	{
+		// Rotating again before .old is compacted would let the journals
+		// grow past an interval each.
+		unique_lock<mutex> guard(lock);
+		compacted.wait(guard, [&] { return !compacting || !error.empty(); });
+		compacting = true;
+		rotationRequested = true;
+		rotationOffset = pending.size();
+	}
+	wake.notify_one();
+}
+
+bool RosterJournal::commit()
+{
+	unique_lock<mutex> guard(lock);
+	uint64_t target = appendedBytes;
+	if (durableBytes < target)
+	{
+		commitRequested = true;
+		wake.notify_one();
+		durable.wait(guard, [&] { return durableBytes >= target || !error.empty(); });
+	}
+	return error.empty();
+}
+
+void RosterJournal::flushLoop()
+{
+	vector<char> group;
+	group.reserve(options.groupBytes * 2);
+	unique_lock<mutex> guard(lock);
+	while (true)
+	{
+		wake.wait_for(guard, chrono::milliseconds(options.commitIntervalMs), [&] {
+			return stopping || commitRequested || rotationRequested || pending.size() >= options.groupBytes;
+		});
+		bool stop = stopping;
+		uint64_t target = appendedBytes;
+		bool rotation = rotationRequested;
+		size_t retiredBytes = rotation ? rotationOffset : pending.size();
+		rotationRequested = false;
+		commitRequested = false;
+		group.swap(pending);
+		guard.unlock();
+
+		// Mutations keep filling the other buffer meanwhile. Records up to
+		// the compaction point belong to the journal being retired, the rest
+		// to its successor.
+		if (retiredBytes > 0)
+		{
+			writeGroup(group.data(), retiredBytes);
+		}
+		if (rotation)
+		{
+			rotate();
+			if (group.size() > retiredBytes)
+			{
+				writeGroup(group.data() + retiredBytes, group.size() - retiredBytes);
+			}
+		}
+		group.clear();
+
+		guard.lock();
+		durableBytes = target;
+		durable.notify_all();
+		if (stop)
+		{
+			return;
+		}
+	}
+}
+
+void RosterJournal::writeGroup(char *data, size_t n)
+{
+	for (size_t at = 0; at < n;)
+	{
+		RecordHeader rh;
+		memcpy(&rh, data + at, sizeof(rh));
+		rh.checksum = checksumOf(data + at + sizeof(rh), rh.length);
+		memcpy(data + at, &rh, sizeof(rh));
+		at += sizeof(rh) + rh.length;
+	}
+	if (file == nullptr || fwrite(data, 1, n, file) != n ||
+			(options.sync ? !FileSync::syncFile(file) : fflush(file) != 0))
+	{
+		fail("cannot write " + getJournalPath());
+		return;
+	}
+	groupWrites.fetch_add(1, memory_order_relaxed);
+}
+
+void RosterJournal::rotate()
+{
+	string path = getJournalPath();
+	string oldPath = path + ".old";
+	// If the last compaction failed, .old still holds records no snapshot
+	// covers. Keep appending to the live journal instead; once a snapshot
+	// lands, the records it duplicates replay harmlessly.
+	if (!filesystem::exists(oldPath))
+	{
+		bool closed = file != nullptr && fclose(file) == 0;
+		file = nullptr;
+		error_code ec;
+		if (closed)
+		{
+			filesystem::rename(path, oldPath, ec);
+		}
+		if (!closed || ec)
+		{
+			fail("cannot rotate " + path);
+			compactionDone();
+			return;
+		}
+		string message;
+		if (!createJournal(message) || !FileSync::syncParentDirectory(path))
+		{
+			fail(message.empty() ? "cannot sync the directory of " + path : message);
+			compactionDone();
+			return;
+		}
+	}
+	if (compactor.joinable())
+	{
+		compactor.join();
+	}
+	compactor = thread(&RosterJournal::compactRetired, this);
+}
+
+bool RosterJournal::foldRetired(EmployeeColumns &columns, string &message)
+{
+	string path = getSnapshotPath();
+	if (filesystem::exists(path))
+	{
+		RosterSnapshot snapshot;
+		if (!snapshot.open(path))
+		{
+			message = snapshot.getError();
+			return false;
+		}
+		if (!snapshot.verifyChecksum())
+		{
+			message = path + " failed its checksum";
+			return false;
+		}
+		columns.reserve(snapshot.size());
+		for (size_t i = 0; i < snapshot.size(); i++)
+		{
+			columns.add(snapshot.typeAt(i), snapshot.nameAt(i), snapshot.birthDateAt(i), snapshot.unitsAt(i));
+		}
+	}
+	AddFn add = [&columns](EmployeeType type, string_view name, string_view birthDate, int units) {
+		columns.add(type, name, birthDate, units);
+	};
+	SetUnitsFn setUnits = [&columns](size_t row, int units) { columns.setUnits(row, units); };
+	ReplayState state{columns.size(), add, setUnits};
+	size_t replayed = 0;
+	return replayFile(getJournalPath() + ".old", false, state, replayed, message);
+}
+
+void RosterJournal::compactRetired()
+{
+	// The previous snapshot plus the retired journal is the roster as of
+	// the rotation. write() syncs the new snapshot and its directory, so
+	// once it returns the records in .old are safe on disk twice over and
+	// .old can go.
+	EmployeeColumns columns;
+	string message;
+	if (foldRetired(columns, message) && RosterSnapshot::write(getSnapshotPath(), columns, message))
+	{
+		error_code ec;
+		filesystem::remove(getJournalPath() + ".old", ec);
+		compactions.fetch_add(1, memory_order_relaxed);
+	}
+	else
+	{
+		fail(message);
+	}
+	compactionDone();
+}
+
+void RosterJournal::compactionDone()
+{
+	{
+		lock_guard<mutex> guard(lock);
+		compacting = false;
+	}
+	compacted.notify_all();
+}
+
+void RosterJournal::fail(const string &message)
+{
+	lock_guard<mutex> guard(lock);
+	if (error.empty())
+	{
+		error = message;
+	}
+	durable.notify_all();
+	compacted.notify_all();
+}
+
+bool RosterJournal::good() const
+{
+	lock_guard<mutex> guard(lock);
+	return error.empty();
+}
+
+size_t RosterJournal::getRecords() const
+{
+	return records;
+}
+
+size_t RosterJournal::getReplayedRecords() const
+{
+	return replayedRecords;
+}
+
+size_t RosterJournal::getDiscardedBytes() const
+{
+	return discardedBytes;
+}
+
+size_t RosterJournal::getGroupWrites() const
+{
+	return groupWrites.load(memory_order_relaxed);
+}
+
+size_t RosterJournal::getCompactions() const
+{
+	return compactions.load(memory_order_relaxed);
+}
+
+string RosterJournal::getError() const
+{
+	lock_guard<mutex> guard(lock);
+	return error;
+}
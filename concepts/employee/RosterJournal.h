@@ -0,0 +1,162 @@
+#ifndef ROSTERJOURNAL_H
+#define ROSTERJOURNAL_H
+
+#include "EmployeeColumns.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// Append-only write-ahead log of roster mutations, kept next to a
+// RosterSnapshot of the compacted state. For a base path "roster":
+//
+//   roster.snap         RosterSnapshot of every mutation up to a rotation
+//   roster.journal      mutations since the last rotation
+//   roster.journal.old  the previous journal while it is being compacted
+//
+// A mutation is one memcpy into an in-memory buffer. A background thread
+// writes the buffer out and syncs it every commit interval or whenever
+// groupBytes have piled up, so many mutations share one write and one
+// sync (group commit). commit() blocks until everything logged so far is
+// durable.
+//
+// Every compactEvery records the owner marks a rotation point. The records
+// logged before it are written out, the journal is rotated to .old, later
+// records go to the new journal, and a second thread loads the previous
+// snapshot, replays .old onto it, writes the result as the new snapshot
+// and deletes .old. The owner never copies its roster, but if the previous
+// compaction is still running when the next is due it waits for it, so
+// neither journal holds more than one interval. Recovery therefore
+// replays at most two intervals of records on top of the snapshot,
+// however long the roster has been running.
+//
+// Each record carries the row it applies to, so replaying a journal that
+// the snapshot already covers is harmless: adds below the snapshot's row
+// count are skipped and unit updates are re-applied in log order. A torn
+// record at the end of the live journal (a crash mid-write) is cut off.
+class RosterJournal
+{
+public:
+	static const uint32_t VERSION = 1;
+
+	struct Options
+	{
+		// Write out once this many bytes are buffered...
+		size_t groupBytes = 64 * 1024;
+
+		// ...or at least this often.
+		unsigned commitIntervalMs = 10;
+
+		// fsync after each group write; off trades durability for speed.
+		bool sync = true;
+
+		// Records between compactions; bounds recovery time.
+		size_t compactEvery = 100000;
+	};
+
+	typedef std::function<void(EmployeeType type, std::string_view name, std::string_view birthDate, int units)> AddFn;
+	typedef std::function<void(size_t row, int units)> SetUnitsFn;
+
+	RosterJournal(const std::string &basePath, const Options &options);
+
+	// Flushes and syncs the tail and waits for a running compaction.
+	~RosterJournal();
+
+	RosterJournal(const RosterJournal &) = delete;
+	RosterJournal &operator=(const RosterJournal &) = delete;
+
+	std::string getSnapshotPath() const;
+	std::string getJournalPath() const;
+
+	// Replays the journals on top of a snapshot of snapshotRows rows that
+	// the caller has already loaded, then starts logging. Returns false if
+	// a journal is unreadable or its records do not line up.
+	bool open(size_t snapshotRows, const AddFn &add, const SetUnitsFn &setUnits);
+
+	void logAdd(size_t row, EmployeeType type, std::string_view name, std::string_view birthDate, int units);
+
+	void logSetUnits(size_t row, int units);
+
+	// True once compactEvery records have been logged since the last
+	// compaction.
+	bool compactionDue() const
+	{
+		return sinceCompaction >= options.compactEvery;
+	}
+
+	// Rotates the journal at the records logged so far and compacts it into
+	// the snapshot in the background. Waits first for a compaction that is
+	// still running.
+	void compact();
+
+	// Blocks until every record logged so far is written and synced.
+	bool commit();
+
+	bool good() const;
+
+	size_t getRecords() const;
+	size_t getReplayedRecords() const;
+	size_t getDiscardedBytes() const;
+	size_t getGroupWrites() const;
+	size_t getCompactions() const;
+	std::string getError() const;
+
+private:
+	struct ReplayState
+	{
+		size_t rows;
+		const AddFn &add;
+		const SetUnitsFn &setUnits;
+	};
+
+	// live: the journal being appended to, whose torn tail is cut off.
+	bool replayFile(const std::string &path, bool live, ReplayState &state, size_t &replayed, std::string &message);
+	bool createJournal(std::string &message);
+	void append(const void *data, size_t n);
+	void flushLoop();
+	void writeGroup(char *data, size_t n);
+	void rotate();
+	bool foldRetired(EmployeeColumns &columns, std::string &message);
+	void compactRetired();
+	void compactionDone();
+	void fail(const std::string &message);
+
+	std::string basePath;
+	Options options;
+	FILE *file;
+
+	// Guarded by lock: the buffer mutations go into and the flusher's work.
+	mutable std::mutex lock;
+	std::condition_variable wake;
+	std::condition_variable durable;
+	std::condition_variable compacted;
+	std::vector<char> pending;
+	bool rotationRequested;
+	size_t rotationOffset; // bytes of pending that precede the rotation point
+	uint64_t appendedBytes;
+	uint64_t durableBytes;
+	bool commitRequested;
+	bool compacting;
+	bool stopping;
+	std::string error;
+
+	// Owner-thread counters.
+	size_t records;
+	size_t sinceCompaction;
+	size_t replayedRecords;
+	size_t discardedBytes;
+
+	std::atomic<size_t> groupWrites;
+	std::atomic<size_t> compactions;
+	std::thread flusher;
+	std::thread compactor;
+};
+
+#endif // ROSTERJOURNAL_H
@@ -0,0 +1,242 @@
+#include "RosterLoader.h"
+#include <charconv>
+#include <cstring>
+
+using namespace std;
+
+namespace
+{
+	string_view trim(string_view s)
+	{
+		while (!s.empty() && (s.front() == ' ' || s.front() == '\r'))
+		{
+			s.remove_prefix(1);
+		}
+		while (!s.empty() && (s.back() == ' ' || s.back() == '\r'))
+		{
+			s.remove_suffix(1);
+		}
+		return s;
+	}
+
+	// Splits off the next field; returns false if the line is exhausted.
+	bool nextField(string_view &rest, char delimiter, string_view &field)
+	{
+		if (rest.data() == nullptr)
+		{
+			return false;
+		}
+		size_t pos = rest.find(delimiter);
+		if (pos == string_view::npos)
+		{
+			field = trim(rest);
+			rest = string_view();
+		}
+		else
+		{
+			field = trim(rest.substr(0, pos));
+			rest = rest.substr(pos + 1);
+		}
+		return true;
+	}
+
+	bool equalsIgnoreCase(string_view a, const char *b)
+	{
+		size_t n = strlen(b);
+		if (a.size() != n)
+		{
+			return false;
+		}
+		for (size_t i = 0; i < n; i++)
+		{
+			if ((a[i] | 0x20) != b[i])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool parseType(string_view field, EmployeeType &type)
+	{
+		if (field == "1" || equalsIgnoreCase(field, "office"))
+		{
+			type = EmployeeType::Office;
+			return true;
+		}
+		if (field == "2" || equalsIgnoreCase(field, "worker"))
+		{
+			type = EmployeeType::Worker;
+			return true;
+		}
+		return false;
+	}
+}
+
+RosterLoader::RosterLoader() : skippedLines(0) {}
+
+RosterLoader::~RosterLoader()
+{
+	close();
+}
+
+bool RosterLoader::open(const string &path)
+{
+	skippedLines = 0;
+	error.clear();
+	return file.open(path, true, error);
+}
+
+void RosterLoader::close()
+{
+	file.close();
+	skippedLines = 0;
+}
+
+bool RosterLoader::parseLine(string_view line, char delimiter, RosterRow &row)
+{
+	string_view fields[4];
+	return splitLine(line, delimiter, fields) && parseFields(fields, row);
+}
+
+bool RosterLoader::splitLine(string_view line, char delimiter, string_view fields[4])
+{
+	string_view rest = line;
+	for (int f = 0; f < 4; f++)
+	{
+		if (!nextField(rest, delimiter, fields[f]))
+		{
+			return false;
+		}
+	}
+	return rest.data() == nullptr;
+}
+
+bool RosterLoader::parseFields(const string_view fields[4], RosterRow &row)
+{
+	if (!parseType(fields[0], row.type))
+	{
+		return false;
+	}
+	string_view units = fields[3];
+	const char *end = units.data() + units.size();
+	auto result = from_chars(units.data(), end, row.units);
+	if (result.ec != errc() || result.ptr != end || units.empty() || row.units < 0)
+	{
+		return false;
+	}
+	row.name = fields[1];
+	row.birthDate = fields[2];
+	return true;
+}
+
+char RosterLoader::detectDelimiter(const char *data, size_t size)
+{
+	const char *firstEnd = static_cast<const char *>(memchr(data, '\n', size));
+	string_view firstLine(data, firstEnd ? firstEnd - data : size);
+	return firstLine.find('\t') != string_view::npos ? '\t' : ',';
+}
+
+string_view RosterLoader::trimLine(string_view line)
+{
+	return trim(line);
+}
+
+size_t RosterLoader::load(const function<void(const vector<RosterRow> &)> &onBatch)
+{
+	skippedLines = 0;
+	if (file.data() == nullptr)
+	{
+		return 0;
+	}
+
+	const char *p = file.data();
+	const char *end = p + file.size();
+
+	char delimiter = detectDelimiter(p, file.size());
+
+	vector<RosterRow> batch;
+	batch.reserve(BATCH_SIZE);
+	size_t loaded = 0;
+	bool firstLineSeen = false;
+
+	while (p < end)
+	{
+		const char *nl = static_cast<const char *>(memchr(p, '\n', end - p));
+		const char *lineEnd = nl ? nl : end;
+		string_view line = trim(string_view(p, lineEnd - p));
+		p = lineEnd + 1;
+
+		if (line.empty())
+		{
+			continue;
+		}
+
+		RosterRow row;
+		if (!parseLine(line, delimiter, row))
+		{
+			// A malformed first line is taken to be a header.
+			if (firstLineSeen)
+			{
+				skippedLines++;
+			}
+			firstLineSeen = true;
+			continue;
+		}
+		firstLineSeen = true;
+
+		batch.push_back(row);
+		if (batch.size() == BATCH_SIZE)
+		{
+			onBatch(batch);
+			loaded += batch.size();
+			batch.clear();
+		}
+	}
+
+	if (!batch.empty())
+	{
+		onBatch(batch);
+		loaded += batch.size();
+	}
+	return loaded;
+}
+
+size_t RosterLoader::estimateRows() const
+{
+	if (file.data() == nullptr)
+	{
+		return 0;
+	}
+	// Lines tend to grow or shrink through a file, so average the head and
+	// the tail.
+	const size_t SAMPLE = 65536;
+	size_t head = file.size() < SAMPLE ? file.size() : SAMPLE;
+	size_t tail = file.size() - head < SAMPLE ? file.size() - head : SAMPLE;
+	const char *samples[2][2] = {{file.data(), file.data() + head}, {file.data() + file.size() - tail, file.data() + file.size()}};
+	size_t lines = 0;
+	for (const auto &range : samples)
+	{
+		const char *p = range[0];
+		while ((p = static_cast<const char *>(memchr(p, '\n', range[1] - p))) != nullptr)
+		{
+			lines++;
+			p++;
+		}
+	}
+	if (lines == 0)
+	{
+		return 1;
+	}
+	return static_cast<size_t>(static_cast<double>(file.size()) * lines / (head + tail));
+}
+
+size_t RosterLoader::getSkippedLines() const
+{
+	return skippedLines;
+}
+
+const string &RosterLoader::getError() const
+{
+	return error;
+}
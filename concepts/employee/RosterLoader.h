@@ -0,0 +1,79 @@
+#ifndef ROSTERLOADER_H
+#define ROSTERLOADER_H
+
+#include "Employee.h"
+#include "MappedFile.h"
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// One parsed roster line. The string views point into the mapped file and
+// stay valid until the loader is closed.
+struct RosterRow
+{
+	EmployeeType type;
+	std::string_view name;
+	std::string_view birthDate;
+	int units;
+};
+
+// Bulk importer for CSV or TSV rosters with the columns
+//   type, name, birthDate, workingDays|noOfProducts
+// where type is 1/2 or office/worker (the same choices as enterList) and
+// the units are a non-negative integer. The birth date is kept as written,
+// like one typed into enterList.
+// The file is memory-mapped and parsed in place; rows are handed out in
+// batches of BATCH_SIZE. A header line and blank lines are skipped, and
+// malformed lines are counted rather than aborting the import.
+class RosterLoader
+{
+public:
+	static const size_t BATCH_SIZE = 65536;
+
+	RosterLoader();
+
+	~RosterLoader();
+
+	RosterLoader(const RosterLoader &) = delete;
+	RosterLoader &operator=(const RosterLoader &) = delete;
+
+	bool open(const std::string &path);
+
+	void close();
+
+	// Parses the whole file. Returns the number of rows delivered.
+	size_t load(const std::function<void(const std::vector<RosterRow> &)> &onBatch);
+
+	// Parses one line (without its terminator). Returns false if malformed.
+	static bool parseLine(std::string_view line, char delimiter, RosterRow &row);
+
+	// The two halves of parseLine(): cutting a line into its four trimmed
+	// fields, and checking and converting them. Every reader of the roster
+	// format validates rows with parseFields().
+	static bool splitLine(std::string_view line, char delimiter, std::string_view fields[4]);
+
+	static bool parseFields(const std::string_view fields[4], RosterRow &row);
+
+	// The file's delimiter, guessed from its first line: tab or comma.
+	static char detectDelimiter(const char *data, size_t size);
+
+	// A line without its terminator and surrounding blanks.
+	static std::string_view trimLine(std::string_view line);
+
+	// Rough number of rows in the open file, from its size and the length
+	// of its first lines; for sizing structures before load().
+	size_t estimateRows() const;
+
+	size_t getSkippedLines() const;
+
+	const std::string &getError() const;
+
+private:
+	MappedFile file;
+	size_t skippedLines;
+	std::string error;
+};
+
+#endif // ROSTERLOADER_H
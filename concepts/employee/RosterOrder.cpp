@@ -0,0 +1,175 @@
+#include "RosterOrder.h"
+#include "BirthDate.h"
+#include "OfficeEmployee.h"
+#include "Worker.h"
+#include <algorithm>
+#include <string_view>
+#include <utility>
+
+using namespace std;
+
+namespace
+{
+	// Ascending key for descending salary.
+	uint64_t salaryKey(EmployeeType type, int units)
+	{
+		int64_t rate = type == EmployeeType::Office ? OfficeEmployee::DAILY_RATE : Worker::PRODUCT_RATE;
+		return ~(static_cast<uint64_t>(rate * units) ^ (1ULL << 63));
+	}
+}
+
+RosterOrder::RosterOrder(const EmployeeColumns &columns) : columns(columns), valid{false, false, false}
+{
+}
+
+const vector<uint32_t> &RosterOrder::sorted(SortKey key)
+{
+	int k = static_cast<int>(key);
+	vector<uint32_t> &rows = orders[k];
+	if (valid[k])
+	{
+		return rows;
+	}
+
+	size_t n = columns.size();
+	rows.resize(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		rows[i] = static_cast<uint32_t>(i);
+	}
+	if (key == SortKey::Name)
+	{
+		// Resolve every name once rather than on each comparison.
+		vector<string_view> names(n);
+		for (size_t i = 0; i < n; i++)
+		{
+			names[i] = columns.nameAt(i);
+		}
+		stable_sort(rows.begin(), rows.end(), [&names](uint32_t a, uint32_t b) { return names[a] < names[b]; });
+	}
+	else
+	{
+		vector<uint64_t> keys(n);
+		if (key == SortKey::Salary)
+		{
+			const EmployeeType *types = columns.types();
+			const int32_t *units = columns.units();
+			for (size_t i = 0; i < n; i++)
+			{
+				keys[i] = salaryKey(types[i], units[i]);
+			}
+		}
+		else
+		{
+			const int32_t *days = columns.birthDays();
+			for (size_t i = 0; i < n; i++)
+			{
+				int32_t day = days[i];
+				keys[i] = day == BirthDate::INVALID ? ~0ULL : static_cast<uint32_t>(day) ^ 0x80000000u;
+			}
+		}
+		radixSort(keys, rows);
+	}
+	valid[k] = true;
+	return rows;
+}
+
+void RosterOrder::radixSort(vector<uint64_t> &keys, vector<uint32_t> &rows)
+{
+	size_t n = keys.size();
+	vector<size_t> counts(8 * 256, 0);
+	for (uint64_t key : keys)
+	{
+		for (unsigned d = 0; d < 8; d++)
+		{
+			counts[d * 256 + ((key >> (8 * d)) & 0xff)]++;
+		}
+	}
+
+	vector<uint64_t> keyBuffer(n);
+	vector<uint32_t> rowBuffer(n);
+	for (unsigned d = 0; d < 8; d++)
+	{
+		size_t *count = counts.data() + d * 256;
+		unsigned shift = 8 * d;
+		if (count[(keys.empty() ? 0 : keys[0] >> shift) & 0xff] == n)
+		{
+			continue; // every key has this digit
+		}
+		size_t offset = 0;
+		for (size_t b = 0; b < 256; b++)
+		{
+			size_t c = count[b];
+			count[b] = offset;
+			offset += c;
+		}
+		for (size_t i = 0; i < n; i++)
+		{
+			size_t slot = count[(keys[i] >> shift) & 0xff]++;
+			keyBuffer[slot] = keys[i];
+			rowBuffer[slot] = rows[i];
+		}
+		keys.swap(keyBuffer);
+		rows.swap(rowBuffer);
+	}
+}
+
+vector<size_t> RosterOrder::topEarners(size_t n) const
+{
+	n = min(n, columns.size());
+	vector<size_t> top;
+	top.reserve(n);
+	if (valid[static_cast<int>(SortKey::Salary)])
+	{
+		const vector<uint32_t> &rows = orders[static_cast<int>(SortKey::Salary)];
+		top.assign(rows.begin(), rows.begin() + n);
+		return top;
+	}
+	if (n == 0)
+	{
+		return top;
+	}
+
+	// Max-heap of the n smallest (key, row) pairs seen so far. Rows arrive in
+	// ascending order, so a later row only displaces the worst on a smaller key.
+	const EmployeeType *types = columns.types();
+	const int32_t *units = columns.units();
+	vector<pair<uint64_t, uint32_t>> heap;
+	heap.reserve(n);
+	for (size_t i = 0; i < columns.size(); i++)
+	{
+		uint64_t key = salaryKey(types[i], units[i]);
+		if (heap.size() < n)
+		{
+			heap.emplace_back(key, static_cast<uint32_t>(i));
+			push_heap(heap.begin(), heap.end());
+		}
+		else if (key < heap.front().first)
+		{
+			pop_heap(heap.begin(), heap.end());
+			heap.back() = make_pair(key, static_cast<uint32_t>(i));
+			push_heap(heap.begin(), heap.end());
+		}
+	}
+	sort_heap(heap.begin(), heap.end());
+	for (const pair<uint64_t, uint32_t> &entry : heap)
+	{
+		top.push_back(entry.second);
+	}
+	return top;
+}
+
+bool RosterOrder::isCached(SortKey key) const
+{
+	return valid[static_cast<int>(key)];
+}
+
+void RosterOrder::rowAdded()
+{
+	valid[0] = valid[1] = valid[2] = false;
+}
+
+void RosterOrder::unitsChanged()
+{
+	valid[static_cast<int>(SortKey::Salary)] = false;
+}
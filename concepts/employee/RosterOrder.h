@@ -0,0 +1,58 @@
+#ifndef ROSTERORDER_H
+#define ROSTERORDER_H
+
+#include "EmployeeColumns.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+enum class SortKey
+{
+	Salary,		// highest first
+	Name,			// A to Z
+	BirthDate // oldest first, unreadable dates last
+};
+
+// Sorted views of an EmployeeColumns, as row permutations. Ties keep
+// roster order.
+//
+// Salary and birth date are numeric: each row gets a 64-bit key that
+// orders ascending, and the rows are sorted by an LSD radix sort with
+// 8-bit digits. One pass counts all eight digits at once, and digits that
+// are the same in every key are skipped, so the usual salaries and day
+// numbers take three or four scatter passes. Names are compared as strings.
+//
+// A permutation is built on first use and kept until a mutation makes it
+// stale: an added row invalidates every order, changed units only the
+// salary order. topEarners() picks the first n rows in one pass with a
+// bounded heap and never sorts the whole roster.
+class RosterOrder
+{
+public:
+	explicit RosterOrder(const EmployeeColumns &columns);
+
+	RosterOrder(const RosterOrder &) = delete;
+	RosterOrder &operator=(const RosterOrder &) = delete;
+
+	// Every row in key order. BirthDate needs columns.parseBirthDays() to
+	// cover the roster first.
+	const std::vector<uint32_t> &sorted(SortKey key);
+
+	// The n best paid rows, highest first; the start of sorted(Salary).
+	std::vector<size_t> topEarners(size_t n) const;
+
+	bool isCached(SortKey key) const;
+
+	void rowAdded();
+	void unitsChanged();
+
+	// Stable sort of rows by keys; both arrays are permuted together.
+	static void radixSort(std::vector<uint64_t> &keys, std::vector<uint32_t> &rows);
+
+private:
+	const EmployeeColumns &columns;
+	std::vector<uint32_t> orders[3];
+	bool valid[3];
+};
+
+#endif // ROSTERORDER_H
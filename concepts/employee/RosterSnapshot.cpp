@@ -0,0 +1,331 @@
+#include "RosterSnapshot.h"
+#include "FileSync.h"
+#include "OfficeEmployee.h"
+#include "Worker.h"
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+	const char MAGIC[8] = {'E', 'M', 'P', 'S', 'N', 'A', 'P', '\0'};
+	const uint64_t RECORDS_OFFSET = 64;
+
+	// 64-bit multiply-xor hash fed one word at a time. Bytes are buffered
+	// until a full word is available, so the result does not depend on how
+	// the input is split across update() calls.
+	class Checksum
+	{
+	public:
+		Checksum() : hash(0xcbf29ce484222325ULL), pendingBytes(0), total(0) {}
+
+		void update(const void *data, size_t n)
+		{
+			const unsigned char *p = static_cast<const unsigned char *>(data);
+			total += n;
+			while (n > 0 && pendingBytes > 0)
+			{
+				pending[pendingBytes++] = *p++;
+				n--;
+				if (pendingBytes == 8)
+				{
+					mixWord(pending);
+					pendingBytes = 0;
+				}
+			}
+			for (; n >= 8; p += 8, n -= 8)
+			{
+				mixWord(p);
+			}
+			memcpy(pending + pendingBytes, p, n);
+			pendingBytes += n;
+		}
+
+		uint64_t finish() const
+		{
+			uint64_t h = hash;
+			for (size_t i = 0; i < pendingBytes; i++)
+			{
+				h = (h ^ pending[i]) * 0x100000001b3ULL;
+			}
+			h ^= total;
+			h ^= h >> 33;
+			h *= 0xff51afd7ed558ccdULL;
+			return h ^ (h >> 33);
+		}
+
+	private:
+		void mixWord(const unsigned char *p)
+		{
+			uint64_t word;
+			memcpy(&word, p, 8);
+			hash = (hash ^ word) * 0x9e3779b97f4a7c15ULL;
+			hash ^= hash >> 29;
+		}
+
+		uint64_t hash;
+		unsigned char pending[8];
+		size_t pendingBytes;
+		uint64_t total;
+	};
+
+	// Buffered writer that checksums everything after the header.
+	class SnapshotWriter
+	{
+	public:
+		explicit SnapshotWriter(FILE *file) : file(file), ok(true)
+		{
+			buffer.reserve(1 << 20);
+		}
+
+		void put(const void *data, size_t n)
+		{
+			checksum.update(data, n);
+			const char *p = static_cast<const char *>(data);
+			buffer.insert(buffer.end(), p, p + n);
+			if (buffer.size() >= (1 << 20))
+			{
+				flush();
+			}
+		}
+
+		void flush()
+		{
+			if (!buffer.empty() && fwrite(buffer.data(), 1, buffer.size(), file) != buffer.size())
+			{
+				ok = false;
+			}
+			buffer.clear();
+		}
+
+		uint64_t sum() const
+		{
+			return checksum.finish();
+		}
+
+		bool good() const
+		{
+			return ok;
+		}
+
+	private:
+		FILE *file;
+		vector<char> buffer;
+		Checksum checksum;
+		bool ok;
+	};
+}
+
+RosterSnapshot::RosterSnapshot()
+		: header(nullptr), records(nullptr), heap(nullptr)
+{
+}
+
+RosterSnapshot::~RosterSnapshot()
+{
+	close();
+}
+
+bool RosterSnapshot::write(const string &path, const EmployeeColumns &columns, string &error)
+{
+	// Written to a temporary name and renamed, so a crash never leaves a
+	// half-written snapshot under the real name.
+	string tmpPath = path + ".tmp";
+	FILE *file = fopen(tmpPath.c_str(), "wb");
+	if (file == nullptr)
+	{
+		error = "cannot create " + tmpPath;
+		return false;
+	}
+
+	Header h;
+	memset(&h, 0, sizeof(h));
+	char padding[RECORDS_OFFSET] = {};
+	fwrite(padding, 1, RECORDS_OFFSET, file);
+
+	SnapshotWriter writer(file);
+	size_t n = columns.size();
+	uint64_t heapSize = 0;
+	for (size_t i = 0; i < n; i++)
+	{
+		Record r;
+		memset(&r, 0, sizeof(r));
+		string_view name = columns.nameAt(i);
+		string_view birthDate = columns.birthDateAt(i);
+		r.nameOffset = static_cast<uint32_t>(heapSize);
+		r.nameLength = static_cast<uint32_t>(name.size());
+		heapSize += name.size();
+		r.birthDateOffset = static_cast<uint32_t>(heapSize);
+		r.birthDateLength = static_cast<uint32_t>(birthDate.size());
+		heapSize += birthDate.size();
+		r.type = static_cast<uint8_t>(columns.typeAt(i));
+		r.units = columns.unitsAt(i);
+		writer.put(&r, sizeof(r));
+	}
+	if (heapSize > UINT32_MAX)
+	{
+		fclose(file);
+		remove(tmpPath.c_str());
+		error = "string heap exceeds 4 GiB";
+		return false;
+	}
+	for (size_t i = 0; i < n; i++)
+	{
+		string_view name = columns.nameAt(i);
+		string_view birthDate = columns.birthDateAt(i);
+		writer.put(name.data(), name.size());
+		writer.put(birthDate.data(), birthDate.size());
+	}
+	writer.flush();
+
+	memcpy(h.magic, MAGIC, sizeof(MAGIC));
+	h.version = VERSION;
+	h.recordSize = sizeof(Record);
+	h.recordCount = n;
+	h.recordsOffset = RECORDS_OFFSET;
+	h.heapOffset = RECORDS_OFFSET + n * sizeof(Record);
+	h.heapSize = heapSize;
+	h.checksum = writer.sum();
+
+	// The data must be on disk before the rename makes it the snapshot, and
+	// the rename itself must be on disk before the caller relies on it.
+	bool ok = writer.good() && fseek(file, 0, SEEK_SET) == 0 && fwrite(&h, sizeof(h), 1, file) == 1 &&
+						FileSync::syncFile(file);
+	ok = fclose(file) == 0 && ok;
+	if (!ok || rename(tmpPath.c_str(), path.c_str()) != 0)
+	{
+		remove(tmpPath.c_str());
+		error = "cannot write " + path;
+		return false;
+	}
+	if (!FileSync::syncParentDirectory(path))
+	{
+		error = "cannot sync the directory of " + path;
+		return false;
+	}
+	return true;
+}
+
+uint64_t RosterSnapshot::bodyChecksum(const void *body, size_t n)
+{
+	Checksum checksum;
+	checksum.update(body, n);
+	return checksum.finish();
+}
+
+bool RosterSnapshot::open(const string &path)
+{
+	close();
+	if (!file.open(path, false, error))
+	{
+		return false;
+	}
+	const char *data = file.data();
+	size_t length = file.size();
+
+	header = reinterpret_cast<const Header *>(data);
+	if (length < RECORDS_OFFSET || memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0)
+	{
+		error = path + " is not a roster snapshot";
+		close();
+		return false;
+	}
+	if (header->version != VERSION || header->recordSize != sizeof(Record))
+	{
+		error = path + " has unsupported snapshot version " + to_string(header->version);
+		close();
+		return false;
+	}
+	uint64_t recordBytes = header->recordCount * sizeof(Record);
+	if (header->recordsOffset != RECORDS_OFFSET ||
+			header->recordCount > (length - RECORDS_OFFSET) / sizeof(Record) ||
+			header->heapOffset != RECORDS_OFFSET + recordBytes ||
+			header->heapSize != length - header->heapOffset)
+	{
+		error = path + " is truncated or corrupt";
+		close();
+		return false;
+	}
+
+	records = reinterpret_cast<const Record *>(data + header->recordsOffset);
+	heap = data + header->heapOffset;
+	return true;
+}
+
+void RosterSnapshot::close()
+{
+	file.close();
+	header = nullptr;
+	records = nullptr;
+	heap = nullptr;
+}
+
+bool RosterSnapshot::verifyChecksum() const
+{
+	if (header == nullptr)
+	{
+		return false;
+	}
+	if (bodyChecksum(file.data() + RECORDS_OFFSET, file.size() - RECORDS_OFFSET) != header->checksum)
+	{
+		return false;
+	}
+	// Every record must also have a known type and strings inside the heap.
+	for (size_t i = 0; i < size(); i++)
+	{
+		const Record &r = records[i];
+		if ((r.type != static_cast<uint8_t>(EmployeeType::Office) && r.type != static_cast<uint8_t>(EmployeeType::Worker)) ||
+				static_cast<uint64_t>(r.nameOffset) + r.nameLength > header->heapSize ||
+				static_cast<uint64_t>(r.birthDateOffset) + r.birthDateLength > header->heapSize)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+size_t RosterSnapshot::size() const
+{
+	return header ? static_cast<size_t>(header->recordCount) : 0;
+}
+
+EmployeeType RosterSnapshot::typeAt(size_t i) const
+{
+	return static_cast<EmployeeType>(records[i].type);
+}
+
+int RosterSnapshot::unitsAt(size_t i) const
+{
+	return records[i].units;
+}
+
+string_view RosterSnapshot::nameAt(size_t i) const
+{
+	return string_view(heap + records[i].nameOffset, records[i].nameLength);
+}
+
+string_view RosterSnapshot::birthDateAt(size_t i) const
+{
+	return string_view(heap + records[i].birthDateOffset, records[i].birthDateLength);
+}
+
+double RosterSnapshot::calculateTotalSalary() const
+{
+	int64_t officeUnits = 0;
+	int64_t workerUnits = 0;
+	for (size_t i = 0; i < size(); i++)
+	{
+		int64_t u = records[i].units;
+		int64_t isOffice = records[i].type == static_cast<uint8_t>(EmployeeType::Office);
+		officeUnits += u * isOffice;
+		workerUnits += u * (1 - isOffice);
+	}
+	return static_cast<double>(officeUnits * OfficeEmployee::DAILY_RATE + workerUnits * Worker::PRODUCT_RATE);
+}
+
+const string &RosterSnapshot::getError() const
+{
+	return error;
+}
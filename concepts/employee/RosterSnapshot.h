@@ -0,0 +1,93 @@
+#ifndef ROSTERSNAPSHOT_H
+#define ROSTERSNAPSHOT_H
+
+#include "EmployeeColumns.h"
+#include "MappedFile.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// Versioned binary roster snapshot that is used in place through mmap.
+//
+// Layout (native byte order):
+//   Header   magic, version, record count, section offsets, body checksum
+//   Records  one fixed-width Record per employee
+//   Heap     names and birth dates, referenced by offset/length
+//
+// open() only validates the header and section bounds, so opening costs
+// the same for ten rows or ten million, and the accessors below read the
+// mapping in place. EmployeeManagement does not: loadSnapshot() and
+// openJournal() verify the body and copy every row into the manager's
+// pools, columns and indexes, which is linear in the roster
+// (snapshot_bench times both). verifyChecksum() walks the whole
+// body when integrity matters more than start-up time, and also rejects
+// records with an unknown type or strings outside the heap. write() syncs
+// the file and its directory, so a snapshot it reports written survives a
+// crash.
+class RosterSnapshot
+{
+public:
+	static const uint32_t VERSION = 1;
+
+	struct Header
+	{
+		char magic[8];
+		uint32_t version;
+		uint32_t recordSize;
+		uint64_t recordCount;
+		uint64_t recordsOffset;
+		uint64_t heapOffset;
+		uint64_t heapSize;
+		uint64_t checksum;
+	};
+
+	struct Record
+	{
+		uint32_t nameOffset;
+		uint32_t nameLength;
+		uint32_t birthDateOffset;
+		uint32_t birthDateLength;
+		uint8_t type;
+		uint8_t reserved[3];
+		int32_t units;
+	};
+
+	RosterSnapshot();
+
+	~RosterSnapshot();
+
+	RosterSnapshot(const RosterSnapshot &) = delete;
+	RosterSnapshot &operator=(const RosterSnapshot &) = delete;
+
+	static bool write(const std::string &path, const EmployeeColumns &columns, std::string &error);
+
+	// Header checksum of a body (everything after the header) of n bytes.
+	static uint64_t bodyChecksum(const void *body, size_t n);
+
+	bool open(const std::string &path);
+
+	void close();
+
+	bool verifyChecksum() const;
+
+	size_t size() const;
+
+	EmployeeType typeAt(size_t i) const;
+	int unitsAt(size_t i) const;
+	std::string_view nameAt(size_t i) const;
+	std::string_view birthDateAt(size_t i) const;
+
+	double calculateTotalSalary() const;
+
+	const std::string &getError() const;
+
+private:
+	MappedFile file;
+	const Header *header;
+	const Record *records;
+	const char *heap;
+	std::string error;
+};
+
+#endif // ROSTERSNAPSHOT_H
@@ -0,0 +1,258 @@
+#include "ScriptRunner.h"
+#include "EmployeeManagement.cpp"
+#include "MappedFile.h"
+#include <charconv>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+using namespace std;
+
+namespace
+{
+	bool isBlank(char c)
+	{
+		return c == ' ' || c == '\t' || c == '\r';
+	}
+
+	// Splits a line into blank-separated, optionally double-quoted tokens.
+	// Returns false on an unterminated quote or more than max tokens.
+	bool tokenize(string_view line, string_view *tokens, size_t max, size_t &n, string &reason)
+	{
+		n = 0;
+		size_t i = 0;
+		while (true)
+		{
+			while (i < line.size() && isBlank(line[i]))
+			{
+				i++;
+			}
+			if (i == line.size())
+			{
+				return true;
+			}
+			if (n == max)
+			{
+				reason = "too many arguments";
+				return false;
+			}
+			size_t start = i;
+			if (line[i] == '"')
+			{
+				size_t close = line.find('"', i + 1);
+				if (close == string_view::npos)
+				{
+					reason = "unterminated quote";
+					return false;
+				}
+				tokens[n++] = line.substr(i + 1, close - i - 1);
+				i = close + 1;
+				continue;
+			}
+			while (i < line.size() && !isBlank(line[i]))
+			{
+				i++;
+			}
+			tokens[n++] = line.substr(start, i - start);
+		}
+	}
+
+	bool toNumber(string_view token, long long &value)
+	{
+		const char *end = token.data() + token.size();
+		from_chars_result result = from_chars(token.data(), end, value);
+		return !token.empty() && result.ec == errc() && result.ptr == end;
+	}
+}
+
+ScriptRunner::ScriptRunner(EmployeeManagement &manager, ostream &out, ostream &err)
+		: manager(manager), err(err), output(out), commands(0), errors(0)
+{
+}
+
+size_t ScriptRunner::run(string_view text)
+{
+	size_t failedBefore = errors;
+	string_view tokens[MAX_TOKENS];
+	string reason;
+	size_t lineNo = 0;
+	const char *p = text.data();
+	const char *end = p + text.size();
+	while (p < end)
+	{
+		const char *nl = static_cast<const char *>(memchr(p, '\n', end - p));
+		const char *lineEnd = nl ? nl : end;
+		string_view line(p, lineEnd - p);
+		p = lineEnd + 1;
+		lineNo++;
+
+		size_t first = 0;
+		while (first < line.size() && isBlank(line[first]))
+		{
+			first++;
+		}
+		if (first == line.size() || line[first] == '#')
+		{
+			continue;
+		}
+
+		size_t n;
+		bool ok = tokenize(line, tokens, MAX_TOKENS, n, reason);
+		commands++;
+		if (ok && execute(tokens, n, reason))
+		{
+			continue;
+		}
+		errors++;
+		// Keep stdout and stderr in order when both go to a terminal.
+		output.flush();
+		err << "line " << lineNo << ": " << reason << "\n";
+	}
+	output.flush();
+	return errors - failedBefore;
+}
+
+bool ScriptRunner::runFile(const string &path)
+{
+	if (path == "-")
+	{
+		ostringstream text;
+		text << cin.rdbuf();
+		run(text.str());
+		return true;
+	}
+	MappedFile file;
+	string error;
+	if (!file.open(path, true, error))
+	{
+		err << error << "\n";
+		return false;
+	}
+	run(string_view(file.data(), file.size()));
+	return true;
+}
+
+bool ScriptRunner::execute(const string_view *tokens, size_t n, string &reason)
+{
+	string_view command = tokens[0];
+	if (command == "register")
+	{
+		RosterRow row;
+		if (n != 5 || !RosterLoader::parseFields(tokens + 1, row))
+		{
+			reason = "usage: register <office|worker> <name> <birthDate> <units>";
+			return false;
+		}
+		bool added;
+		if (row.type == EmployeeType::Office)
+		{
+			added = manager.createOfficeEmployee(row.name, row.birthDate, row.units) != NULL;
+		}
+		else
+		{
+			added = manager.createWorker(row.name, row.birthDate, row.units) != NULL;
+		}
+		if (!added)
+		{
+			reason = "already registered: " + string(row.name) + " " + string(row.birthDate);
+		}
+		return added;
+	}
+
+	if (command == "list")
+	{
+		long long first = 1;
+		long long last = static_cast<long long>(manager.size());
+		if (n == 3 ? !toNumber(tokens[1], first) || !toNumber(tokens[2], last) : n != 1)
+		{
+			reason = "usage: list [first last]";
+			return false;
+		}
+		for (long long i = first < 1 ? 1 : first; i <= last && i <= static_cast<long long>(manager.size()); i++)
+		{
+			printRow(static_cast<size_t>(i - 1));
+		}
+		return true;
+	}
+
+	if (command == "total")
+	{
+		if (n != 1)
+		{
+			reason = "usage: total";
+			return false;
+		}
+		output.append("total\t");
+		output.appendInt(static_cast<long long>(manager.calculateTotalSalary()));
+		output.append("\n");
+		return true;
+	}
+
+	if (command == "query" && n >= 3)
+	{
+		string_view by = tokens[1];
+		long long a, b;
+		if (by == "name" && n == 3)
+		{
+			printRows(manager.findByName(tokens[2]));
+			return true;
+		}
+		if (by == "prefix" && n == 3)
+		{
+			printRows(manager.findByNamePrefix(tokens[2]));
+			return true;
+		}
+		if (by == "prefix" && n == 4 && toNumber(tokens[3], a) && a >= 0)
+		{
+			printRows(manager.findByNamePrefix(tokens[2], static_cast<size_t>(a)));
+			return true;
+		}
+		if (by == "born" && n == 4 && toNumber(tokens[2], a) && toNumber(tokens[3], b))
+		{
+			printRows(manager.findBornBetween(static_cast<int>(a), static_cast<int>(b)));
+			return true;
+		}
+	}
+	if (command == "query")
+	{
+		reason = "usage: query name <name> | prefix <prefix> [limit] | born <fromYear> <toYear>";
+		return false;
+	}
+
+	reason = "unknown command '" + string(command) + "'";
+	return false;
+}
+
+void ScriptRunner::printRows(const vector<size_t> &rows)
+{
+	for (size_t i : rows)
+	{
+		printRow(i);
+	}
+}
+
+void ScriptRunner::printRow(size_t i)
+{
+	const EmployeeColumns &columns = manager.getColumns();
+	output.appendInt(static_cast<long long>(i + 1));
+	output.append(columns.typeAt(i) == EmployeeType::Office ? "\toffice\t" : "\tworker\t");
+	output.append(columns.nameAt(i));
+	output.append("\t");
+	output.append(columns.birthDateAt(i));
+	output.append("\t");
+	output.appendInt(columns.unitsAt(i));
+	output.append("\t");
+	output.appendInt(static_cast<long long>(columns.salaryAt(i)));
+	output.append("\n");
+	output.flushIfFull();
+}
+
+size_t ScriptRunner::getCommands() const
+{
+	return commands;
+}
+
+size_t ScriptRunner::getErrors() const
+{
+	return errors;
+}
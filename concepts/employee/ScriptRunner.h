@@ -0,0 +1,60 @@
+#ifndef SCRIPTRUNNER_H
+#define SCRIPTRUNNER_H
+
+#include "BufferedWriter.h"
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class EmployeeManagement;
+
+// Headless command mode for batch jobs: runs a whole script of commands
+// against an EmployeeManagement with no menus, prompts or banners. One
+// command per line; tokens are separated by blanks and may be
+// double-quoted to hold spaces; '#' starts a comment line.
+//
+//   register <office|worker|1|2> <name> <birthDate> <units>
+//   list [first last]              employees first..last (1-based), or all
+//   total                          total payroll
+//   query name <name>
+//   query prefix <prefix> [limit]
+//   query born <fromYear> <toYear>
+//
+// register fails on a name and birth date already on the roster.
+// list and query print one tab-separated line per employee:
+//   #, type, name, birthDate, units, salary
+// Output goes through a BufferedWriter. A bad command writes
+// "line N: <reason>" to the error stream and the script carries on.
+class ScriptRunner
+{
+public:
+	static const size_t MAX_TOKENS = 8;
+
+	ScriptRunner(EmployeeManagement &manager, std::ostream &out, std::ostream &err);
+
+	// Runs every command in text; returns the number that failed.
+	size_t run(std::string_view text);
+
+	// The script at path, or standard input for "-". Returns false if the
+	// file cannot be read.
+	bool runFile(const std::string &path);
+
+	size_t getCommands() const;
+
+	size_t getErrors() const;
+
+private:
+	bool execute(const std::string_view *tokens, size_t n, std::string &reason);
+	void printRows(const std::vector<size_t> &rows);
+	void printRow(size_t i);
+
+	EmployeeManagement &manager;
+	std::ostream &err;
+	BufferedWriter output;
+	size_t commands;
+	size_t errors;
+};
+
+#endif // SCRIPTRUNNER_H
@@ -0,0 +1,98 @@
+#ifndef SLABPOOL_H
+#define SLABPOOL_H
+
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+
+// Typed slab allocator. Objects are constructed back to back inside large
+// slabs (which double in size up to MAX_SLAB_OBJECTS) and are never freed
+// individually: releaseAll() runs the destructors in allocation order and
+// hands every slab back at once.
+template <typename T>
+class SlabPool
+{
+public:
+	static const size_t MIN_SLAB_OBJECTS = 64;
+	static const size_t MAX_SLAB_OBJECTS = 65536;
+
+	SlabPool() : usedInLast(0), count(0), reserved(0) {}
+
+	~SlabPool()
+	{
+		releaseAll();
+	}
+
+	SlabPool(const SlabPool &) = delete;
+	SlabPool &operator=(const SlabPool &) = delete;
+
+	template <typename... Args>
+	T *create(Args &&...args)
+	{
+		if (slabs.empty() || usedInLast == slabs.back().capacity)
+		{
+			grow();
+		}
+		T *p = new (slabs.back().objects + usedInLast) T(std::forward<Args>(args)...);
+		usedInLast++;
+		count++;
+		return p;
+	}
+
+	void releaseAll()
+	{
+		for (size_t s = 0; s < slabs.size(); s++)
+		{
+			size_t used = s + 1 == slabs.size() ? usedInLast : slabs[s].capacity;
+			for (size_t i = 0; i < used; i++)
+			{
+				slabs[s].objects[i].~T();
+			}
+			::operator delete(static_cast<void *>(slabs[s].objects));
+		}
+		slabs.clear();
+		usedInLast = 0;
+		count = 0;
+		reserved = 0;
+	}
+
+	size_t size() const
+	{
+		return count;
+	}
+
+	size_t bytesReserved() const
+	{
+		return reserved * sizeof(T);
+	}
+
+private:
+	struct Slab
+	{
+		T *objects;
+		size_t capacity;
+	};
+
+	void grow()
+	{
+		size_t capacity = slabs.empty() ? MIN_SLAB_OBJECTS : slabs.back().capacity * 2;
+		if (capacity > MAX_SLAB_OBJECTS)
+		{
+			capacity = MAX_SLAB_OBJECTS;
+		}
+		Slab slab;
+		slab.objects = static_cast<T *>(::operator new(capacity * sizeof(T)));
+		slab.capacity = capacity;
+		slabs.push_back(slab);
+		usedInLast = 0;
+		reserved += capacity;
+	}
+
+	std::vector<Slab> slabs;
+	size_t usedInLast;
+	size_t count;
+	size_t reserved;
+};
+
+#endif // SLABPOOL_H
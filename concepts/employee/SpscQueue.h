@@ -0,0 +1,116 @@
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Bounded lock-free queue for exactly one producer thread and one consumer
+// thread. push() waits while the queue is full, which is what gives a
+// pipeline its backpressure: a slow stage stalls the stages feeding it
+// instead of letting work pile up in memory. The producer calls close()
+// once it is done; pop() then drains what is left and returns false.
+template <typename T>
+class SpscQueue
+{
+public:
+	// capacity is rounded up to a power of two.
+	explicit SpscQueue(size_t capacity)
+			: slots(roundUp(capacity)), mask(slots.size() - 1), head(0), tail(0), closed(false),
+				cachedHead(0), fullWaits(0), cachedTail(0), emptyWaits(0)
+	{
+	}
+
+	SpscQueue(const SpscQueue &) = delete;
+	SpscQueue &operator=(const SpscQueue &) = delete;
+
+	void push(T value)
+	{
+		size_t t = tail.load(std::memory_order_relaxed);
+		if (t - cachedHead == slots.size())
+		{
+			cachedHead = head.load(std::memory_order_acquire);
+			while (t - cachedHead == slots.size())
+			{
+				fullWaits++;
+				std::this_thread::yield();
+				cachedHead = head.load(std::memory_order_acquire);
+			}
+		}
+		slots[t & mask] = std::move(value);
+		tail.store(t + 1, std::memory_order_release);
+	}
+
+	bool pop(T &value)
+	{
+		size_t h = head.load(std::memory_order_relaxed);
+		while (h == cachedTail)
+		{
+			cachedTail = tail.load(std::memory_order_acquire);
+			if (h != cachedTail)
+			{
+				break;
+			}
+			if (closed.load(std::memory_order_acquire))
+			{
+				// Anything pushed before close() is visible now.
+				cachedTail = tail.load(std::memory_order_acquire);
+				if (h == cachedTail)
+				{
+					return false;
+				}
+				break;
+			}
+			emptyWaits++;
+			std::this_thread::yield();
+		}
+		value = std::move(slots[h & mask]);
+		head.store(h + 1, std::memory_order_release);
+		return true;
+	}
+
+	void close()
+	{
+		closed.store(true, std::memory_order_release);
+	}
+
+	// Times the producer found the queue full and the consumer found it empty.
+	size_t getFullWaits() const
+	{
+		return fullWaits;
+	}
+
+	size_t getEmptyWaits() const
+	{
+		return emptyWaits;
+	}
+
+private:
+	static size_t roundUp(size_t n)
+	{
+		size_t p = 1;
+		while (p < n)
+		{
+			p *= 2;
+		}
+		return p;
+	}
+
+	std::vector<T> slots;
+	const size_t mask;
+
+	// Each index is written by one side only; keep them on separate cache lines.
+	alignas(64) std::atomic<size_t> head;
+	alignas(64) std::atomic<size_t> tail;
+	alignas(64) std::atomic<bool> closed;
+
+	// Producer-side and consumer-side state.
+	alignas(64) size_t cachedHead;
+	size_t fullWaits;
+	alignas(64) size_t cachedTail;
+	size_t emptyWaits;
+};
+
+#endif // SPSCQUEUE_H
@@ -0,0 +1,194 @@
+#include "StringPool.h"
+#include <cstring>
+#include <functional>
+
+using namespace std;
+
+namespace
+{
+	uint32_t hashString(string_view s)
+	{
+		size_t h = hash<string_view>()(s);
+		return static_cast<uint32_t>(h ^ (h >> 32));
+	}
+}
+
+StringPool &StringPool::shared()
+{
+	static StringPool pool;
+	return pool;
+}
+
+StringPool::StringPool(size_t stripeCount) : count(0)
+{
+	size_t n = 1;
+	while (n < stripeCount && n < STRIPES)
+	{
+		n *= 2;
+	}
+	stripes.reset(new Stripe[n]);
+	stripeMask = n - 1;
+	for (size_t i = 0; i < SEGMENT_SIZE; i++)
+	{
+		segments[i].store(nullptr, memory_order_relaxed);
+	}
+}
+
+StringPool::~StringPool()
+{
+	for (size_t i = 0; i < SEGMENT_SIZE; i++)
+	{
+		delete[] segments[i].load(memory_order_relaxed);
+	}
+}
+
+StringPool::Stripe::Stripe() : cursor(nullptr), remaining(0), blockBytes(0), slots(64, Slot{0, 0}), used(0)
+{
+}
+
+// The top byte picks the stripe; slots index with the low bits.
+StringPool::Stripe &StringPool::stripeOf(uint32_t h) const
+{
+	return stripes[(h >> 24) & stripeMask];
+}
+
+uint32_t StringPool::intern(string_view s)
+{
+	uint32_t h = hashString(s);
+	Stripe &stripe = stripeOf(h);
+	lock_guard<std::mutex> guard(stripe.writeLock);
+
+	size_t slot;
+	if (findLocked(stripe, s, h, slot))
+	{
+		return stripe.slots[slot].id - 1;
+	}
+
+	uint32_t id = count.fetch_add(1, memory_order_relaxed);
+	Entry &e = entry(id);
+	e.data = store(stripe, s);
+	e.length = static_cast<uint32_t>(s.size());
+
+	stripe.slots[slot].hash = h;
+	stripe.slots[slot].id = id + 1;
+	if (++stripe.used * 2 > stripe.slots.size())
+	{
+		grow(stripe);
+	}
+	return id;
+}
+
+// Stripes reach a new segment concurrently; the first to install it wins.
+StringPool::Entry &StringPool::entry(uint32_t id)
+{
+	atomic<Entry *> &segment = segments[id >> SEGMENT_BITS];
+	Entry *entries = segment.load(memory_order_acquire);
+	if (!entries)
+	{
+		Entry *fresh = new Entry[SEGMENT_SIZE];
+		if (segment.compare_exchange_strong(entries, fresh, memory_order_acq_rel))
+		{
+			entries = fresh;
+		}
+		else
+		{
+			delete[] fresh;
+		}
+	}
+	return entries[id & (SEGMENT_SIZE - 1)];
+}
+
+bool StringPool::find(string_view s, uint32_t &id) const
+{
+	uint32_t h = hashString(s);
+	const Stripe &stripe = stripeOf(h);
+	lock_guard<std::mutex> guard(stripe.writeLock);
+	size_t slot;
+	if (!findLocked(stripe, s, h, slot))
+	{
+		return false;
+	}
+	id = stripe.slots[slot].id - 1;
+	return true;
+}
+
+size_t StringPool::size() const
+{
+	return count.load(memory_order_acquire);
+}
+
+size_t StringPool::bytesReserved() const
+{
+	size_t bytes = 0;
+	for (size_t i = 0; i <= stripeMask; i++)
+	{
+		lock_guard<std::mutex> guard(stripes[i].writeLock);
+		bytes += stripes[i].blockBytes + stripes[i].slots.size() * sizeof(Slot);
+	}
+	size_t segmentCount = (count.load(memory_order_relaxed) + SEGMENT_SIZE - 1) / SEGMENT_SIZE;
+	return bytes + segmentCount * SEGMENT_SIZE * sizeof(Entry);
+}
+
+// On a miss, slot is the empty slot where s belongs.
+bool StringPool::findLocked(const Stripe &stripe, string_view s, uint32_t h, size_t &slot) const
+{
+	const vector<Slot> &slots = stripe.slots;
+	size_t mask = slots.size() - 1;
+	for (slot = h & mask; slots[slot].id != 0; slot = (slot + 1) & mask)
+	{
+		if (slots[slot].hash == h && view(slots[slot].id - 1) == s)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+const char *StringPool::store(Stripe &stripe, string_view s)
+{
+	if (s.empty())
+	{
+		return "";
+	}
+	if (s.size() > stripe.remaining)
+	{
+		size_t bytes = s.size() > BLOCK_BYTES / 4 ? s.size() : BLOCK_BYTES;
+		stripe.blocks.emplace_back(new char[bytes]);
+		stripe.blockBytes += bytes;
+		if (bytes != BLOCK_BYTES)
+		{
+			// Oversized strings get a block of their own; keep filling the current one.
+			memcpy(stripe.blocks.back().get(), s.data(), s.size());
+			return stripe.blocks.back().get();
+		}
+		stripe.cursor = stripe.blocks.back().get();
+		stripe.remaining = bytes;
+	}
+	char *p = stripe.cursor;
+	memcpy(p, s.data(), s.size());
+	stripe.cursor += s.size();
+	stripe.remaining -= s.size();
+	return p;
+}
+
+void StringPool::grow(Stripe &stripe)
+{
+	vector<Slot> &slots = stripe.slots;
+	vector<Slot> old;
+	old.swap(slots);
+	slots.assign(old.size() * 2, Slot{0, 0});
+	size_t mask = slots.size() - 1;
+	for (const Slot &slot : old)
+	{
+		if (slot.id == 0)
+		{
+			continue;
+		}
+		size_t i = slot.hash & mask;
+		while (slots[i].id != 0)
+		{
+			i = (i + 1) & mask;
+		}
+		slots[i] = slot;
+	}
+}
@@ -0,0 +1,96 @@
+#ifndef STRINGPOOL_H
+#define STRINGPOOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+// Interned strings for the employee subsystem. Each distinct string is
+// stored once and identified by a 32-bit id; equal strings always get the
+// same id. Characters live in large append-only blocks and are never moved
+// or freed, so a view returned by view() stays valid for the lifetime of
+// the pool and reading it never allocates.
+//
+// The hash table and character blocks are split into stripes by string
+// hash, each behind its own mutex, so threads interning different strings
+// rarely wait on each other; equal strings always land in the same stripe.
+// Ids come from one atomic counter. view() is lock-free: the id table is
+// split into fixed segments that are installed once and never moved.
+class StringPool
+{
+public:
+	static const size_t STRIPES = 16;
+
+	// Process-wide pool used by Employee and EmployeeColumns.
+	static StringPool &shared();
+
+	// stripes is rounded up to a power of two, at most STRIPES.
+	explicit StringPool(size_t stripes = STRIPES);
+
+	~StringPool();
+
+	StringPool(const StringPool &) = delete;
+	StringPool &operator=(const StringPool &) = delete;
+
+	uint32_t intern(std::string_view s);
+
+	// Looks up s without interning it.
+	bool find(std::string_view s, uint32_t &id) const;
+
+	std::string_view view(uint32_t id) const
+	{
+		const Entry &e = segments[id >> SEGMENT_BITS].load(std::memory_order_acquire)[id & (SEGMENT_SIZE - 1)];
+		return std::string_view(e.data, e.length);
+	}
+
+	size_t size() const;
+
+	size_t bytesReserved() const;
+
+private:
+	static const size_t SEGMENT_BITS = 16;
+	static const size_t SEGMENT_SIZE = size_t(1) << SEGMENT_BITS;
+	static const size_t BLOCK_BYTES = 256 * 1024;
+
+	struct Entry
+	{
+		const char *data;
+		uint32_t length;
+	};
+
+	struct Slot
+	{
+		uint32_t hash;
+		uint32_t id; // id + 1, 0 when empty
+	};
+
+	struct alignas(64) Stripe
+	{
+		Stripe();
+
+		std::vector<std::unique_ptr<char[]>> blocks;
+		char *cursor;
+		size_t remaining;
+		size_t blockBytes;
+		std::vector<Slot> slots;
+		size_t used;
+		mutable std::mutex writeLock;
+	};
+
+	Stripe &stripeOf(uint32_t h) const;
+	bool findLocked(const Stripe &stripe, std::string_view s, uint32_t h, size_t &slot) const;
+	Entry &entry(uint32_t id);
+	static const char *store(Stripe &stripe, std::string_view s);
+	static void grow(Stripe &stripe);
+
+	std::atomic<Entry *> segments[SEGMENT_SIZE];
+	std::unique_ptr<Stripe[]> stripes;
+	size_t stripeMask;
+	std::atomic<uint32_t> count;
+};
+
+#endif // STRINGPOOL_H
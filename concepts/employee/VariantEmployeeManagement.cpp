@@ -0,0 +1,128 @@
+#include "VariantEmployeeManagement.h"
+#include <iostream>
+
+using namespace std;
+
+namespace
+{
+	// Qualified calls bypass the vtable; the variant index picks the overload.
+	struct SalaryOf
+	{
+		double operator()(OfficeEmployee &e) const
+		{
+			return e.OfficeEmployee::calculateSalary();
+		}
+
+		double operator()(Worker &e) const
+		{
+			return e.Worker::calculateSalary();
+		}
+	};
+
+	struct Describe
+	{
+		void operator()(OfficeEmployee &e) const
+		{
+			e.OfficeEmployee::describe();
+		}
+
+		void operator()(Worker &e) const
+		{
+			e.Worker::describe();
+		}
+	};
+}
+
+VariantEmployeeManagement::VariantEmployeeManagement() {}
+
+void VariantEmployeeManagement::reserve(size_t n)
+{
+	employees.reserve(n);
+}
+
+size_t VariantEmployeeManagement::size() const
+{
+	return employees.size();
+}
+
+void VariantEmployeeManagement::addOfficeEmployee(string_view name, string_view birthDate, int workingDays)
+{
+	employees.emplace_back(in_place_type<OfficeEmployee>, name, birthDate, workingDays);
+}
+
+void VariantEmployeeManagement::addWorker(string_view name, string_view birthDate, int noOfProducts)
+{
+	employees.emplace_back(in_place_type<Worker>, name, birthDate, noOfProducts);
+}
+
+bool VariantEmployeeManagement::setWorkingDays(size_t i, int wds)
+{
+	if (i >= employees.size())
+	{
+		return false;
+	}
+	OfficeEmployee *e = get_if<OfficeEmployee>(&employees[i]);
+	if (e == nullptr)
+	{
+		return false;
+	}
+	e->setWorkingDays(wds);
+	return true;
+}
+
+bool VariantEmployeeManagement::setNoOfProducts(size_t i, int n)
+{
+	if (i >= employees.size())
+	{
+		return false;
+	}
+	Worker *e = get_if<Worker>(&employees[i]);
+	if (e == nullptr)
+	{
+		return false;
+	}
+	e->setNoOfProducts(n);
+	return true;
+}
+
+const Employee &VariantEmployeeManagement::at(size_t i) const
+{
+	return visit([](const auto &e) -> const Employee & { return e; }, employees[i]);
+}
+
+void VariantEmployeeManagement::displayAll()
+{
+	if (employees.empty())
+	{
+		cout << "\n";
+		cout << "  +-----------------------------+\n";
+		cout << "  |    No employees to show     |\n";
+		cout << "  +-----------------------------+\n";
+		return;
+	}
+
+	cout << "\n";
+	cout << "========================================\n";
+	cout << "         ALL EMPLOYEES (" << employees.size() << ")\n";
+	cout << "========================================\n";
+
+	for (size_t i = 0; i < employees.size(); i++)
+	{
+		cout << "\n  --- Employee #" << i + 1 << " ---";
+		visit(Describe(), employees[i]);
+	}
+
+	cout << "\n========================================\n";
+	cout << "          End of List\n";
+	cout << "========================================\n";
+}
+
+double VariantEmployeeManagement::calculateTotalSalary()
+{
+	double total = 0;
+	for (Record &record : employees)
+	{
+		total += visit(SalaryOf(), record);
+	}
+	return total;
+}
@@ -0,0 +1,44 @@
+#ifndef VARIANTEMPLOYEEMANAGEMENT_H
+#define VARIANTEMPLOYEEMANAGEMENT_H
+
+#include "OfficeEmployee.h"
+#include "Worker.h"
+#include <cstddef>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+// Alternative roster backend for the closed OfficeEmployee/Worker
+// hierarchy. Employees are stored by value in one contiguous vector and
+// dispatched with std::visit, so each call resolves to the concrete
+// class at compile time and calculateSalary() inlines.
+class VariantEmployeeManagement
+{
+public:
+	typedef std::variant<OfficeEmployee, Worker> Record;
+
+	VariantEmployeeManagement();
+
+	void reserve(size_t n);
+
+	size_t size() const;
+
+	void addOfficeEmployee(std::string_view name, std::string_view birthDate, int workingDays);
+
+	void addWorker(std::string_view name, std::string_view birthDate, int noOfProducts);
+
+	bool setWorkingDays(size_t i, int wds);
+
+	bool setNoOfProducts(size_t i, int n);
+
+	const Employee &at(size_t i) const;
+
+	void displayAll();
+
+	double calculateTotalSalary();
+
+private:
+	std::vector<Record> employees;
+};
+
+#endif // VARIANTEMPLOYEEMANAGEMENT_H
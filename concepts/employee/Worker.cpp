@@ -5,7 +5,7 @@ using namespace std;
 
 Worker::Worker() : Employee(), noOfProducts(0) {}
 
-Worker::Worker(const std::string& name, const std::string& birthDate, int n) 
+Worker::Worker(std::string_view name, std::string_view birthDate, int n) 
 	: Employee(name, birthDate), noOfProducts(n)
 {
 }
@@ -17,12 +17,17 @@ void Worker::setNoOfProducts(int n)
 	noOfProducts = n;
 }
 
-double Worker::calculateSalary()
+int Worker::getNoOfProducts() const
 {
-	return noOfProducts * 5000;
+	return noOfProducts;
 }
 
-void Worker::describe()
+EmployeeType Worker::getType() const
+{
+	return EmployeeType::Worker;
+}
+
+void Worker::describe() const
 {
 	cout << "\n";
 	cout << "  +-----------------------------+\n";
@@ -2,25 +2,35 @@
 #define WORKER_H
 
 #include "Employee.h"
+#include "PayPolicy.h"
 #include <string>
 
-class Worker : public Employee
+class Worker final : public Employee
 {
 private:
 	int noOfProducts;
 
 public:
+	static const int PRODUCT_RATE = StandardSchedule::WorkerRate::BASE_RATE;
+
 	Worker();
 
-	Worker(const std::string& name, const std::string& birthDate, int noOfProducts);
+	Worker(std::string_view name, std::string_view birthDate, int noOfProducts);
 
 	~Worker();
 
 	void setNoOfProducts(int n);
 
-	double calculateSalary() override;
+	int getNoOfProducts() const;
+
+	EmployeeType getType() const override;
+
+	double calculateSalary() const override
+	{
+		return static_cast<double>(StandardSchedule::WorkerRate::pay(noOfProducts));
+	}
 
-	void describe() override;
+	void describe() const override;
 
 	void enterInfo() override;
 };
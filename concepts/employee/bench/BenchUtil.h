@@ -0,0 +1,84 @@
+#ifndef BENCHUTIL_H
+#define BENCHUTIL_H
+
+#include "Employee.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+// Shared helpers for the employee benchmarks: a wall-clock timer and a
+// deterministic synthetic roster so every benchmark sees the same data.
+
+class BenchTimer
+{
+public:
+	BenchTimer() : start(std::chrono::steady_clock::now()) {}
+
+	double elapsedNs() const
+	{
+		return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	double elapsedMs() const
+	{
+		return elapsedNs() / 1e6;
+	}
+
+private:
+	std::chrono::steady_clock::time_point start;
+};
+
+inline uint64_t syntheticHash(uint64_t i)
+{
+	// splitmix64 finalizer
+	uint64_t z = i + 0x9e3779b97f4a7c15ULL;
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+	return z ^ (z >> 31);
+}
+
+inline EmployeeType syntheticType(size_t i)
+{
+	return (syntheticHash(i) & 1) ? EmployeeType::Worker : EmployeeType::Office;
+}
+
+inline int syntheticUnits(size_t i)
+{
+	if (syntheticType(i) == EmployeeType::Office)
+	{
+		return static_cast<int>((syntheticHash(i) >> 8) % 23);
+	}
+	return static_cast<int>((syntheticHash(i) >> 8) % 200);
+}
+
+inline std::string syntheticName(size_t i)
+{
+	static const char *first[] = {"Anna", "Binh", "Chen", "Dara", "Eli", "Farah", "Goran", "Hana"};
+	static const char *last[] = {"Nguyen", "Smith", "Tanaka", "Okafor", "Silva", "Novak", "Khan", "Berg"};
+	uint64_t h = syntheticHash(i);
+	return std::string(first[h % 8]) + " " + last[(h >> 3) % 8] + " " + std::to_string(i);
+}
+
+inline std::string syntheticBirthDate(size_t i)
+{
+	uint64_t h = syntheticHash(i) >> 16;
+	char buf[16];
+	std::snprintf(buf, sizeof(buf), "%02d/%02d/%04d",
+								static_cast<int>(h % 28) + 1,
+								static_cast<int>((h >> 5) % 12) + 1,
+								static_cast<int>((h >> 9) % 45) + 1960);
+	return buf;
+}
+
+inline size_t benchSizeArg(int argc, char **argv, size_t fallback)
+{
+	if (argc > 1)
+	{
+		return static_cast<size_t>(std::strtod(argv[1], nullptr));
+	}
+	return fallback;
+}
+
+#endif // BENCHUTIL_H
@@ -0,0 +1,207 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <thread>
+#include <vector>
+#include "BenchUtil.h"
+#include "BirthDate.h"
+#include "OfficeEmployee.h"
+#include "PayrollAggregation.h"
+#include "Worker.h"
+
+using namespace std;
+
+// Finance's questions (totals and extremes by type, totals by birth year,
+// salary percentiles, a salary histogram and the top earners) answered by
+// one scan per question against one fused PayrollAggregation pass, on one
+// thread and on all of them. Exits non-zero if the answers differ.
+//
+// Usage: aggregation_bench [employees] [threads]
+
+namespace
+{
+	const int64_t BUCKET = 50000;
+	const size_t TOP = 10;
+	const double PERCENTILES[] = {0.5, 0.9, 0.99};
+
+	struct Answers
+	{
+		int64_t typeTotal[2] = {0, 0};
+		int64_t typeMax[2] = {0, 0};
+		map<int, int64_t> yearTotals;
+		vector<int64_t> percentiles;
+		vector<size_t> histogram;
+		vector<size_t> topRows;
+	};
+
+	int64_t salaryOf(const EmployeeColumns &columns, size_t i)
+	{
+		int64_t rate = columns.typeAt(i) == EmployeeType::Office ? OfficeEmployee::DAILY_RATE : Worker::PRODUCT_RATE;
+		return columns.unitsAt(i) * rate;
+	}
+
+	Answers separateScans(const EmployeeColumns &columns)
+	{
+		Answers a;
+		size_t n = columns.size();
+		for (size_t i = 0; i < n; i++)
+		{
+			int t = columns.typeAt(i) == EmployeeType::Office ? 0 : 1;
+			int64_t salary = salaryOf(columns, i);
+			a.typeTotal[t] += salary;
+			a.typeMax[t] = max(a.typeMax[t], salary);
+		}
+
+		for (size_t i = 0; i < n; i++)
+		{
+			a.yearTotals[BirthDate::yearOf(columns.birthDayAt(i))] += salaryOf(columns, i);
+		}
+
+		vector<int64_t> salaries(n);
+		for (size_t i = 0; i < n; i++)
+		{
+			salaries[i] = salaryOf(columns, i);
+		}
+		for (double p : PERCENTILES)
+		{
+			size_t rank = static_cast<size_t>(ceil(p * n));
+			nth_element(salaries.begin(), salaries.begin() + (rank - 1), salaries.end());
+			a.percentiles.push_back(salaries[rank - 1]);
+		}
+
+		int64_t lowest = *min_element(salaries.begin(), salaries.end());
+		int64_t highest = *max_element(salaries.begin(), salaries.end());
+		int64_t start = lowest / BUCKET * BUCKET;
+		a.histogram.assign(static_cast<size_t>((highest - start) / BUCKET) + 1, 0);
+		for (size_t i = 0; i < n; i++)
+		{
+			a.histogram[static_cast<size_t>((salaryOf(columns, i) - start) / BUCKET)]++;
+		}
+
+		vector<size_t> rows(n);
+		for (size_t i = 0; i < n; i++)
+		{
+			rows[i] = i;
+		}
+		partial_sort(rows.begin(), rows.begin() + TOP, rows.end(), [&](size_t x, size_t y) {
+			int64_t sx = salaryOf(columns, x);
+			int64_t sy = salaryOf(columns, y);
+			return sx > sy || (sx == sy && x < y);
+		});
+		a.topRows.assign(rows.begin(), rows.begin() + TOP);
+		return a;
+	}
+
+	// The same answers from fused passes: by type, by birth year, and overall.
+	Answers fused(const EmployeeColumns &columns, unsigned threads)
+	{
+		Answers a;
+		AggregationSpec byType;
+		byType.groupByType = true;
+		for (const SalaryAggregate &g : PayrollAggregation::run(columns, byType, threads).groups())
+		{
+			int t = g.type == EmployeeType::Office ? 0 : 1;
+			a.typeTotal[t] = g.total;
+			a.typeMax[t] = g.max;
+		}
+
+		AggregationSpec overall;
+		overall.groupByBirthYear = true;
+		overall.percentiles.assign(begin(PERCENTILES), end(PERCENTILES));
+		overall.histogramWidth = BUCKET;
+		overall.topK = TOP;
+		PayrollAggregation result = PayrollAggregation::run(columns, overall, threads);
+		for (const SalaryAggregate &g : result.groups())
+		{
+			a.yearTotals[g.birthYear] = g.total;
+		}
+		for (const TopEarner &earner : result.topEarners())
+		{
+			a.topRows.push_back(earner.row);
+		}
+
+		// Percentiles and the histogram over everyone need an ungrouped pass.
+		AggregationSpec all;
+		all.percentiles = overall.percentiles;
+		all.histogramWidth = BUCKET;
+		SalaryAggregate everyone = PayrollAggregation::run(columns, all, threads).groups().front();
+		a.percentiles = everyone.percentiles;
+		a.histogram = everyone.histogram;
+		return a;
+	}
+
+	bool same(const Answers &x, const Answers &y)
+	{
+		return equal(begin(x.typeTotal), end(x.typeTotal), begin(y.typeTotal)) &&
+					 equal(begin(x.typeMax), end(x.typeMax), begin(y.typeMax)) &&
+					 x.yearTotals == y.yearTotals && x.percentiles == y.percentiles &&
+					 x.histogram == y.histogram && x.topRows == y.topRows;
+	}
+}
+
+int main(int argc, char **argv)
+{
+	size_t n = benchSizeArg(argc, argv, 5000000);
+	unsigned threads = argc > 2 ? static_cast<unsigned>(atoi(argv[2])) : thread::hardware_concurrency();
+	threads = max(threads, 1u);
+	const int reps = 5;
+
+	EmployeeColumns columns;
+	columns.reserve(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		columns.add(syntheticType(i), "", syntheticBirthDate(i), syntheticUnits(i));
+	}
+	columns.parseBirthDays();
+
+	Answers reference;
+	BenchTimer separateTimer;
+	for (int r = 0; r < reps; r++)
+	{
+		reference = separateScans(columns);
+	}
+	double separateMs = separateTimer.elapsedMs() / reps;
+
+	Answers single;
+	BenchTimer singleTimer;
+	for (int r = 0; r < reps; r++)
+	{
+		single = fused(columns, 1);
+	}
+	double singleMs = singleTimer.elapsedMs() / reps;
+
+	Answers parallel;
+	BenchTimer parallelTimer;
+	for (int r = 0; r < reps; r++)
+	{
+		parallel = fused(columns, threads);
+	}
+	double parallelMs = parallelTimer.elapsedMs() / reps;
+
+	// The fused answers above take three passes to mirror the baseline's
+	// shape; a report that wants them all at once takes one.
+	AggregationSpec everything;
+	everything.groupByType = true;
+	everything.groupByBirthYear = true;
+	everything.percentiles.assign(begin(PERCENTILES), end(PERCENTILES));
+	everything.histogramWidth = BUCKET;
+	everything.topK = TOP;
+	BenchTimer onePassTimer;
+	size_t groups = 0;
+	for (int r = 0; r < reps; r++)
+	{
+		groups = PayrollAggregation::run(columns, everything, threads).groups().size();
+	}
+	double onePassMs = onePassTimer.elapsedMs() / reps;
+
+	bool ok = same(reference, single) && same(reference, parallel);
+	cout << "employees:              " << n << "\n";
+	cout << "one scan per question:  " << separateMs << " ms\n";
+	cout << "fused, 1 thread:        " << singleMs << " ms (" << separateMs / singleMs << "x)\n";
+	cout << "fused, " << threads << " threads:       " << parallelMs << " ms (" << separateMs / parallelMs << "x)\n";
+	cout << "single pass, " << groups << " groups: " << onePassMs << " ms\n";
+	cout << "answers match:          " << (ok ? "yes" : "NO") << "\n";
+	return ok ? 0 : 1;
+}
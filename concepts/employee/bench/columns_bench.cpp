@@ -0,0 +1,77 @@
+#include <iostream>
+#include <vector>
+#include "BenchUtil.h"
+#include "EmployeeColumns.h"
+#include "OfficeEmployee.h"
+#include "Worker.h"
+
+using namespace std;
+
+// Compares the payroll scan over vector<Employee *> (pointer chase plus a
+// virtual call per row) with the scan over EmployeeColumns.
+//
+// Usage: columns_bench [employees]
+
+static double pointerTotal(const vector<Employee *> &list)
+{
+	double total = 0;
+	for (Employee *e : list)
+	{
+		total += e->calculateSalary();
+	}
+	return total;
+}
+
+int main(int argc, char **argv)
+{
+	size_t n = benchSizeArg(argc, argv, 1000000);
+	const int reps = 20;
+
+	vector<Employee *> list;
+	list.reserve(n);
+	EmployeeColumns columns;
+	columns.reserve(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		string name = syntheticName(i);
+		string birthDate = syntheticBirthDate(i);
+		int units = syntheticUnits(i);
+		if (syntheticType(i) == EmployeeType::Office)
+		{
+			list.push_back(new OfficeEmployee(name, birthDate, units));
+		}
+		else
+		{
+			list.push_back(new Worker(name, birthDate, units));
+		}
+		columns.add(syntheticType(i), name, birthDate, units);
+	}
+
+	double pointerSum = 0;
+	BenchTimer pointerTimer;
+	for (int r = 0; r < reps; r++)
+	{
+		pointerSum += pointerTotal(list);
+	}
+	double pointerNs = pointerTimer.elapsedNs() / reps;
+
+	double columnSum = 0;
+	BenchTimer columnTimer;
+	for (int r = 0; r < reps; r++)
+	{
+		columnSum += columns.calculateTotalSalary();
+	}
+	double columnNs = columnTimer.elapsedNs() / reps;
+
+	cout << "employees:           " << n << "\n";
+	cout << "pointer-vector scan: " << pointerNs / n << " ns/employee\n";
+	cout << "columnar scan:       " << columnNs / n << " ns/employee\n";
+	cout << "speedup:             " << pointerNs / columnNs << "x\n";
+	cout << "totals match:        " << (pointerSum == columnSum ? "yes" : "NO") << "\n";
+
+	for (Employee *e : list)
+	{
+		delete e;
+	}
+	return pointerSum == columnSum ? 0 : 1;
+}
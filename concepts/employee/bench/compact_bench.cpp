@@ -0,0 +1,105 @@
+#include <iostream>
+#include <vector>
+#include "BenchUtil.h"
+#include "EmployeeManagement.cpp"
+
+using namespace std;
+
+// Memory footprint and payroll scan time of the roster packed into 16-byte
+// EmployeeRecords by EmployeeManagement::toRecords(), against the managed
+// roster. Checks that every record converts back to the same
+// OfficeEmployee/Worker and that addRecords() rebuilds an identical
+// roster.
+//
+// Usage: compact_bench [employees]
+
+int main(int argc, char **argv)
+{
+	size_t n = benchSizeArg(argc, argv, 1000000);
+	const int reps = 20;
+
+	EmployeeManagement management;
+	for (size_t i = 0; i < n; i++)
+	{
+		if (syntheticType(i) == EmployeeType::Office)
+		{
+			management.createOfficeEmployee(syntheticName(i), syntheticBirthDate(i), syntheticUnits(i));
+		}
+		else
+		{
+			management.createWorker(syntheticName(i), syntheticBirthDate(i), syntheticUnits(i));
+		}
+	}
+
+	BenchTimer packTimer;
+	vector<EmployeeRecord> records = management.toRecords();
+	double packNs = packTimer.elapsedNs() / n;
+
+	size_t mismatches = 0;
+	for (size_t i = 0; i < n; i++)
+	{
+		const Employee *original = management.getEmployee(i);
+		Employee *copy = records[i].toEmployee();
+		if (copy->getName() != original->getName() || copy->getBirthDate() != original->getBirthDate() ||
+				copy->calculateSalary() != original->calculateSalary())
+		{
+			mismatches++;
+		}
+		delete copy;
+	}
+
+	EmployeeManagement restored;
+	BenchTimer unpackTimer;
+	restored.addRecords(records);
+	double unpackNs = unpackTimer.elapsedNs() / n;
+	const EmployeeColumns &a = management.getColumns();
+	const EmployeeColumns &b = restored.getColumns();
+	for (size_t i = 0; i < n; i++)
+	{
+		if (a.typeAt(i) != b.typeAt(i) || a.unitsAt(i) != b.unitsAt(i) || a.nameAt(i) != b.nameAt(i) ||
+				a.birthDateAt(i) != b.birthDateAt(i))
+		{
+			mismatches++;
+		}
+	}
+
+	double objectTotal = 0;
+	BenchTimer objectTimer;
+	for (int r = 0; r < reps; r++)
+	{
+		double total = 0;
+		for (size_t i = 0; i < n; i++)
+		{
+			total += management.getEmployee(i)->calculateSalary();
+		}
+		objectTotal = total;
+	}
+	double objectNs = objectTimer.elapsedNs() / reps / n;
+
+	double recordTotal = 0;
+	BenchTimer recordTimer;
+	for (int r = 0; r < reps; r++)
+	{
+		double total = 0;
+		for (const EmployeeRecord &record : records)
+		{
+			total += record.salary();
+		}
+		recordTotal = total;
+	}
+	double recordNs = recordTimer.elapsedNs() / reps / n;
+	bool totalsMatch = objectTotal == recordTotal && restored.calculateTotalSalary() == objectTotal;
+
+	cout << "employees:          " << n << "\n";
+	cout << "object bytes/emp:   " << management.bytesPerEmployee() << "\n";
+	cout << "record bytes/emp:   " << static_cast<double>(records.capacity() * sizeof(EmployeeRecord)) / n << "\n";
+	cout << "pack:               " << packNs << " ns/employee\n";
+	cout << "unpack:             " << unpackNs << " ns/employee\n";
+	cout << "object scan:        " << objectNs << " ns/employee\n";
+	cout << "record scan:        " << recordNs << " ns/employee\n";
+	cout << "speedup:            " << objectNs / recordNs << "x\n";
+	cout << "round-trip errors:  " << mismatches << "\n";
+	cout << "totals match:       " << (totalsMatch ? "yes" : "NO") << "\n";
+
+	return mismatches == 0 && totalsMatch ? 0 : 1;
+}
@@ -0,0 +1,214 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BenchUtil.h"
+#include "ConcurrentEmployeeManagement.h"
+#include "EmployeeManagement.cpp"
+
+using namespace std;
+
+// Mixed load: writer threads load a synthetic roster in batches while
+// reader threads query the payroll as fast as they can. Runs against
+// ConcurrentEmployeeManagement and against EmployeeManagement behind a
+// mutex, the simplest way to share the original.
+//
+// Doubles as a stress test of the concurrent backend. Readers check that
+// every snapshot only grows, an auditor thread checks that each snapshot's
+// payroll equals the sum over the rows it lists, and the final roster must
+// hold every row with the expected payroll. Exits non-zero if any check fails.
+//
+// Usage: concurrent_bench [employees] [writers] [readers]
+
+namespace
+{
+	const size_t BATCH_ROWS = 1024;
+
+	struct Strings
+	{
+		vector<string> names;
+		vector<string> birthDates;
+	};
+
+	struct Result
+	{
+		double ingestMs = 0;
+		size_t queries = 0;
+		double maxQueryNs = 0;
+		bool ok = true;
+	};
+
+	// Rows [first, last) of the synthetic roster, in batches, handed to add().
+	template <typename Add>
+	void loadRows(const Strings &strings, size_t first, size_t last, Add add)
+	{
+		vector<RosterRow> rows;
+		rows.reserve(BATCH_ROWS);
+		for (size_t i = first; i < last; i++)
+		{
+			size_t names = strings.names.size();
+			rows.push_back(RosterRow{syntheticType(i), strings.names[i % names],
+															 strings.birthDates[i / names % strings.birthDates.size()], syntheticUnits(i)});
+			if (rows.size() == BATCH_ROWS || i + 1 == last)
+			{
+				add(rows);
+				rows.clear();
+			}
+		}
+	}
+
+	// Runs writers and readers together; query(reader) returns false on a
+	// failed check.
+	template <typename Add, typename Query>
+	Result mixedLoad(const Strings &strings, size_t n, unsigned writers, unsigned readers, Add add, Query query)
+	{
+		Result result;
+		atomic<unsigned> writing(writers);
+		atomic<size_t> queries(0);
+		atomic<bool> ok(true);
+		vector<double> maxNs(readers, 0);
+
+		vector<thread> threads;
+		for (unsigned r = 0; r < readers; r++)
+		{
+			threads.emplace_back([&, r]() {
+				size_t count = 0;
+				while (writing.load(memory_order_acquire) > 0)
+				{
+					BenchTimer timer;
+					if (!query(r))
+					{
+						ok = false;
+					}
+					maxNs[r] = max(maxNs[r], timer.elapsedNs());
+					count++;
+				}
+				queries += count;
+			});
+		}
+
+		BenchTimer ingest;
+		for (unsigned w = 0; w < writers; w++)
+		{
+			threads.emplace_back([&, w]() {
+				loadRows(strings, n * w / writers, n * (w + 1) / writers, add);
+				writing--;
+			});
+		}
+		for (unsigned t = readers; t < threads.size(); t++)
+		{
+			threads[t].join();
+		}
+		result.ingestMs = ingest.elapsedMs();
+		for (unsigned r = 0; r < readers; r++)
+		{
+			threads[r].join();
+		}
+
+		result.queries = queries;
+		result.maxQueryNs = *max_element(maxNs.begin(), maxNs.end());
+		result.ok = ok;
+		return result;
+	}
+
+	void report(const char *label, size_t n, const Result &result)
+	{
+		cout << label << "\n";
+		cout << "  ingest:        " << n / result.ingestMs / 1000 << " M rows/s\n";
+		cout << "  queries:       " << result.queries / result.ingestMs / 1000 << " M/s during ingest\n";
+		cout << "  max query:     " << result.maxQueryNs / 1000 << " us\n";
+	}
+}
+
+int main(int argc, char **argv)
+{
+	size_t n = benchSizeArg(argc, argv, 4000000);
+	unsigned writers = argc > 2 ? static_cast<unsigned>(atoi(argv[2])) : 4;
+	unsigned readers = argc > 3 ? static_cast<unsigned>(atoi(argv[3])) : 4;
+	writers = max(writers, 1u);
+	readers = max(readers, 1u);
+
+	// A fixed pool of distinct strings keeps generation out of the timings.
+	// Row i pairs name i % 65536 with birth date i / 65536, so no two rows
+	// are the same employee and EmployeeManagement keeps them all.
+	Strings strings;
+	int32_t firstDay = BirthDate::fromCivil(1900, 1, 1);
+	for (size_t i = 0; i < 65536; i++)
+	{
+		strings.names.push_back(syntheticName(i));
+		strings.birthDates.push_back(BirthDate::format(firstDay + static_cast<int32_t>(i)));
+	}
+	double expected = 0;
+	for (size_t i = 0; i < n; i++)
+	{
+		expected += syntheticType(i) == EmployeeType::Office ? syntheticUnits(i) * OfficeEmployee::DAILY_RATE
+																												 : syntheticUnits(i) * Worker::PRODUCT_RATE;
+	}
+
+	cout << "employees: " << n << ", writers: " << writers << ", readers: " << readers << "\n\n";
+
+	ConcurrentEmployeeManagement roster;
+
+	// Walks whole snapshots while the load runs: the payroll a snapshot
+	// reports must equal the sum over the rows it lists.
+	atomic<bool> auditOk(true);
+	size_t audits = 0;
+	thread auditor([&]() {
+		size_t seen;
+		do
+		{
+			ConcurrentEmployeeManagement::Snapshot snapshot = roster.snapshot();
+			seen = snapshot.size();
+			double listed = 0;
+			snapshot.forEach([&](const EmployeeRecord &r) { listed += r.salary(); });
+			if (listed != snapshot.totalSalary())
+			{
+				auditOk = false;
+			}
+			audits++;
+		} while (seen < n);
+	});
+
+	vector<ConcurrentEmployeeManagement::Snapshot> previous(readers, roster.snapshot());
+	Result concurrent = mixedLoad(
+			strings, n, writers, readers,
+			[&](const vector<RosterRow> &rows) { roster.addBatch(rows); },
+			[&](unsigned reader) {
+				ConcurrentEmployeeManagement::Snapshot snapshot = roster.snapshot();
+				bool grew = true;
+				for (size_t s = 0; s < ConcurrentEmployeeManagement::SHARDS; s++)
+				{
+					grew = grew && snapshot.size(s) >= previous[reader].size(s);
+				}
+				previous[reader] = snapshot;
+				return grew && snapshot.totalSalary() >= 0;
+			});
+	auditor.join();
+	bool finalOk = roster.size() == n && roster.calculateTotalSalary() == expected;
+	report("ConcurrentEmployeeManagement", n, concurrent);
+	cout << "  snapshots monotonic:  " << (concurrent.ok ? "yes" : "NO") << "\n";
+	cout << "  snapshots consistent: " << (auditOk ? "yes" : "NO") << " (" << audits << " audited)\n";
+	cout << "  final roster:         " << (finalOk ? "complete" : "WRONG") << "\n\n";
+
+	EmployeeManagement manager;
+	mutex managerLock;
+	Result locked = mixedLoad(
+			strings, n, writers, readers,
+			[&](const vector<RosterRow> &rows) {
+				lock_guard<mutex> lock(managerLock);
+				manager.addBatch(rows);
+			},
+			[&](unsigned) {
+				lock_guard<mutex> lock(managerLock);
+				return manager.calculateTotalSalary() >= 0;
+			});
+	report("EmployeeManagement + mutex", n, locked);
+	bool lockedOk = manager.size() == n && manager.calculateTotalSalary() == expected;
+	cout << "  final roster:         " << (lockedOk ? "complete" : "WRONG") << "\n";
+
+	return concurrent.ok && auditOk && finalOk && lockedOk ? 0 : 1;
+}
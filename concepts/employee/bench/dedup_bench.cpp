@@ -0,0 +1,128 @@
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include <sstream>
+#include "BenchUtil.h"
+#include "EmployeeManagement.cpp"
+#include "ScriptRunner.h"
+
+using namespace std;
+
+// Writes a synthetic CSV roster in which a share of the rows repeat an
+// earlier employee's name and birth date, imports it, and checks that
+// exactly the repeats were dropped. Reports import speed, the duplicate
+// filter's memory and its false-positive rate, and times the same key
+// stream through a std::unordered_set<string> for reference. Also checks
+// that single adds, script registrations and snapshot loads drop repeats
+// too.
+//
+// Usage: dedup_bench [employees] [duplicate percent]
+
+namespace
+{
+	bool singleAddsDeduplicated()
+	{
+		EmployeeManagement manager;
+		bool ok = manager.createWorker("Ann Berg", "01/02/1990", 10) != NULL &&
+							manager.createOfficeEmployee("Ann Berg", "01/02/1990", 5) == NULL &&
+							!manager.addEmployee(new Worker("Ann Berg", "01/02/1990", 3)) &&
+							manager.addEmployee(new Worker("Ann Berg", "02/02/1990", 3)) &&
+							manager.createOfficeEmployee("Ann Bergman", "01/02/1990", 5) != NULL;
+
+		ostringstream out, err;
+		ScriptRunner runner(manager, out, err);
+		size_t errors = runner.run("register worker \"Ann Berg\" 01/02/1990 7\n"
+															 "register office \"Bo Lind\" 03/04/1985 20\n"
+															 "register office \"Bo Lind\" 03/04/1985 21\n");
+		return ok && errors == 2 && manager.size() == 4;
+	}
+
+	// Loading a snapshot into a roster that already holds its employees
+	// adds only the ones it lacks.
+	bool snapshotLoadsDeduplicated(const string &path)
+	{
+		EmployeeManagement saved;
+		saved.createWorker("Ann Berg", "01/02/1990", 10);
+		saved.createOfficeEmployee("Bo Lind", "03/04/1985", 20);
+		ostringstream sink;
+		streambuf *console = cout.rdbuf(sink.rdbuf());
+		bool ok = saved.saveSnapshot(path);
+
+		EmployeeManagement manager;
+		manager.createWorker("Bo Lind", "03/04/1985", 5);
+		ok = ok && manager.loadSnapshot(path) == 1 && manager.loadSnapshot(path) == 0;
+		cout.rdbuf(console);
+		remove(path.c_str());
+		return ok && manager.size() == 2 && manager.findByName("Ann Berg").size() == 1 &&
+					 manager.calculateTotalSalary() == manager.recomputeTotalSalary();
+	}
+}
+
+int main(int argc, char **argv)
+{
+	size_t n = benchSizeArg(argc, argv, 1000000);
+	unsigned percent = argc > 2 ? static_cast<unsigned>(atoi(argv[2])) : 10;
+	string path = "dedup_bench_roster.csv";
+
+	// Row i repeats row source[i], or is new when source[i] == i.
+	vector<size_t> source(n);
+	size_t expectedDuplicates = 0;
+	for (size_t i = 0; i < n; i++)
+	{
+		uint64_t h = syntheticHash(i + n);
+		source[i] = i > 0 && h % 100 < percent ? source[(h >> 8) % i] : i;
+		expectedDuplicates += source[i] != i;
+	}
+	vector<string> names(n), birthDates(n);
+	{
+		ofstream out(path, ios::binary);
+		out << "type,name,birthDate,units\n";
+		for (size_t i = 0; i < n; i++)
+		{
+			names[i] = syntheticName(source[i]);
+			birthDates[i] = syntheticBirthDate(source[i]);
+			out << (syntheticType(i) == EmployeeType::Office ? "office" : "worker") << ',' << names[i] << ','
+					<< birthDates[i] << ',' << syntheticUnits(i) << '\n';
+		}
+	}
+
+	EmployeeManagement manager;
+	BenchTimer importTimer;
+	size_t added = manager.importFile(path);
+	double importMs = importTimer.elapsedMs();
+	remove(path.c_str());
+	const DuplicateFilter &filter = manager.getDuplicates();
+
+	BenchTimer setTimer;
+	unordered_set<string> seen;
+	size_t setDuplicates = 0;
+	for (size_t i = 0; i < n; i++)
+	{
+		setDuplicates += !seen.insert(names[i] + '\t' + birthDates[i]).second;
+	}
+	double setNs = setTimer.elapsedNs() / n;
+
+	bool ok = added == n - expectedDuplicates && manager.size() == added &&
+						filter.getDuplicates() == expectedDuplicates && setDuplicates == expectedDuplicates;
+	for (size_t s = 0; s < 1000 && ok; s++)
+	{
+		size_t i = syntheticHash(s) % n;
+		ok = manager.findByName(names[i]).size() == 1;
+	}
+
+	printf("\nrows: %zu, duplicates: %zu expected, %zu dropped\n", n, expectedDuplicates, filter.getDuplicates());
+	printf("import:             %10.1f ms  (%.1f ns/row)\n", importMs, importMs * 1e6 / n);
+	printf("unordered_set:      %10.1f ns/row for the keys alone\n", setNs);
+	printf("bloom filter:       %10.1f MiB  (%.1f bits/key)\n", filter.filterBytes() / 1048576.0,
+				 8.0 * filter.filterBytes() / filter.keys());
+	printf("exact set:          %10.1f MiB  (%.1f bytes/key)\n", filter.setBytes() / 1048576.0,
+				 static_cast<double>(filter.setBytes()) / filter.keys());
+	printf("false positives:    %10zu  (%.3f%% of new keys)\n", filter.getFalsePositives(), 100.0 * filter.falsePositiveRate());
+	bool singleOk = singleAddsDeduplicated() && snapshotLoadsDeduplicated("dedup_bench_roster.snap");
+	printf("results match:      %s\n", ok ? "yes" : "NO");
+	printf("single adds, loads: %s\n", singleOk ? "deduplicated" : "DUPLICATES KEPT");
+	ok = ok && singleOk;
+	return ok ? 0 : 1;
+}
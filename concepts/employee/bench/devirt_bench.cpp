@@ -0,0 +1,63 @@
+#include <iostream>
+#include <vector>
+#include "BenchUtil.h"
+#include "EmployeeManagement.cpp"
+
+using namespace std;
+
+// Payroll summed over the employee objects two ways: a virtual
+// calculateSalary() call through Employee *, and
+// EmployeeManagement::recomputeTotalSalary(), which takes each row's type
+// from the columns and calls the final leaf class directly. Exits
+// non-zero if either total differs from the columnar one.
+//
+// Usage: devirt_bench [employees]
+
+int main(int argc, char **argv)
+{
+	size_t n = benchSizeArg(argc, argv, 1000000);
+	const int reps = 20;
+
+	EmployeeManagement manager;
+	for (size_t i = 0; i < n; i++)
+	{
+		if (syntheticType(i) == EmployeeType::Office)
+		{
+			manager.createOfficeEmployee(syntheticName(i), syntheticBirthDate(i), syntheticUnits(i));
+		}
+		else
+		{
+			manager.createWorker(syntheticName(i), syntheticBirthDate(i), syntheticUnits(i));
+		}
+	}
+	double expected = manager.getColumns().calculateTotalSalary();
+
+	double virtualSum = 0;
+	BenchTimer virtualTimer;
+	for (int r = 0; r < reps; r++)
+	{
+		double total = 0;
+		for (size_t i = 0; i < n; i++)
+		{
+			total += manager.getEmployee(i)->calculateSalary();
+		}
+		virtualSum = total;
+	}
+	double virtualNs = virtualTimer.elapsedNs() / reps / n;
+
+	double directSum = 0;
+	BenchTimer directTimer;
+	for (int r = 0; r < reps; r++)
+	{
+		directSum = manager.recomputeTotalSalary();
+	}
+	double directNs = directTimer.elapsedNs() / reps / n;
+
+	bool ok = virtualSum == expected && directSum == expected;
+	cout << "employees:         " << n << "\n";
+	cout << "virtual dispatch:  " << virtualNs << " ns/employee\n";
+	cout << "final, direct:     " << directNs << " ns/employee\n";
+	cout << "speedup:           " << virtualNs / directNs << "x\n";
+	cout << "totals match:      " << (ok ? "yes" : "NO") << "\n";
+	return ok ? 0 : 1;
+}
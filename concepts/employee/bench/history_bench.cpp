@@ -0,0 +1,141 @@
+#include <cstdio>
+#include <vector>
+#include "BenchUtil.h"
+#include "PayrollHistory.h"
+#include "OfficeEmployee.h"
+#include "Worker.h"
+
+using namespace std;
+
+// Years of monthly payroll for a growing roster, kept in PayrollHistory
+// and, for checking, as plain int32 arrays. Reports the compression ratio
+// and times a period total, year-to-date for every employee and
+// year-to-date for single employees against the same scans over the raw
+// arrays. Exits non-zero on any mismatch.
+//
+// Usage: history_bench [employees] [years]
+
+namespace
+{
+	// Units of row i in period p: mostly a steady monthly figure with
+	// some month-to-month variation.
+	int unitsIn(size_t i, int p)
+	{
+		int base = syntheticUnits(i);
+		int swing = static_cast<int>(syntheticHash(i * 977 + p) % 5) - 2;
+		int units = base + swing;
+		return units < 0 ? 0 : units;
+	}
+}
+
+int main(int argc, char **argv)
+{
+	size_t n = benchSizeArg(argc, argv, 200000);
+	int years = argc > 2 ? atoi(argv[2]) : 10;
+	int periods = years * 12;
+	const int firstYear = 2015;
+
+	// The roster starts at 70% of n and hires steadily up to n.
+	EmployeeColumns columns;
+	columns.reserve(n);
+	PayrollHistory history;
+	vector<vector<int32_t>> raw(periods);
+	double closeMs = 0;
+	for (int p = 0; p < periods; p++)
+	{
+		size_t rows = n * 7 / 10 + (n - n * 7 / 10) * (p + 1) / periods;
+		while (columns.size() < rows)
+		{
+			size_t i = columns.size();
+			columns.add(syntheticType(i), syntheticName(i), syntheticBirthDate(i), 0);
+		}
+		raw[p].resize(rows);
+		for (size_t i = 0; i < rows; i++)
+		{
+			raw[p][i] = unitsIn(i, p);
+			columns.setUnits(i, raw[p][i]);
+		}
+		BenchTimer timer;
+		if (!history.closePeriod(firstYear + p / 12, p % 12 + 1, columns))
+		{
+			fprintf(stderr, "%s\n", history.getError().c_str());
+			return 1;
+		}
+		closeMs += timer.elapsedMs();
+	}
+
+	bool ok = true;
+	const EmployeeType *types = columns.types();
+	auto rawSalary = [&](int p, size_t i) {
+		int64_t rate = types[i] == EmployeeType::Office ? OfficeEmployee::DAILY_RATE : Worker::PRODUCT_RATE;
+		return raw[p][i] * rate;
+	};
+
+	// Total payroll of every period.
+	BenchTimer rawTotalTimer;
+	vector<int64_t> rawTotals(periods, 0);
+	for (int p = 0; p < periods; p++)
+	{
+		for (size_t i = 0; i < raw[p].size(); i++)
+		{
+			rawTotals[p] += rawSalary(p, i);
+		}
+	}
+	double rawTotalMs = rawTotalTimer.elapsedMs() / periods;
+
+	BenchTimer totalTimer;
+	vector<int64_t> totals(periods);
+	for (int p = 0; p < periods; p++)
+	{
+		totals[p] = history.totalSalary(firstYear + p / 12, p % 12 + 1);
+	}
+	double totalMs = totalTimer.elapsedMs() / periods;
+	ok = ok && totals == rawTotals;
+
+	// Year to date through December of the last year, for everyone.
+	int lastYear = firstYear + years - 1;
+	BenchTimer rawYtdTimer;
+	vector<int64_t> rawYtd(n, 0);
+	for (int p = (years - 1) * 12; p < periods; p++)
+	{
+		for (size_t i = 0; i < raw[p].size(); i++)
+		{
+			rawYtd[i] += rawSalary(p, i);
+		}
+	}
+	double rawYtdMs = rawYtdTimer.elapsedMs();
+
+	BenchTimer ytdTimer;
+	vector<int64_t> ytd = history.yearToDate(lastYear, 12);
+	double ytdMs = ytdTimer.elapsedMs();
+	ok = ok && ytd == rawYtd;
+
+	// Single employees, spread over the roster, and one spot check per row
+	// sample of unitsAt().
+	const size_t samples = 10000;
+	BenchTimer oneTimer;
+	for (size_t s = 0; s < samples; s++)
+	{
+		size_t i = syntheticHash(s) % n;
+		ok = ok && history.yearToDate(i, lastYear, 12) == rawYtd[i];
+	}
+	double oneNs = oneTimer.elapsedNs() / samples;
+	for (size_t s = 0; s < samples; s++)
+	{
+		size_t i = syntheticHash(s + samples) % n;
+		int p = static_cast<int>(syntheticHash(s) % periods);
+		int expected = i < raw[p].size() ? raw[p][i] : 0;
+		ok = ok && history.unitsAt(i, firstYear + p / 12, p % 12 + 1) == expected;
+	}
+
+	printf("employees: %zu, periods: %d\n", n, periods);
+	printf("raw int32:          %10.1f MiB\n", history.rawBytes() / 1048576.0);
+	printf("compressed:         %10.1f MiB  (%.1fx, %.2f bits/value)\n", history.bytesUsed() / 1048576.0,
+				 static_cast<double>(history.rawBytes()) / history.bytesUsed(), 32.0 * history.bytesUsed() / history.rawBytes());
+	printf("close period:       %10.2f ms/period\n", closeMs / periods);
+	printf("period total:       %10.3f ms   raw scan %.3f ms\n", totalMs, rawTotalMs);
+	printf("year to date, all:  %10.3f ms   raw scan %.3f ms\n", ytdMs, rawYtdMs);
+	printf("year to date, one:  %10.1f ns\n", oneNs);
+	printf("results match:      %s\n", ok ? "yes" : "NO");
+	return ok ? 0 : 1;
+}
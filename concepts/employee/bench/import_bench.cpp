@@ -0,0 +1,41 @@
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include "BenchUtil.h"
+#include "EmployeeManagement.cpp"
+
+using namespace std;
+
+// Writes a synthetic CSV roster and times EmployeeManagement::importFile().
+//
+// Usage: import_bench [employees] [path]
+
+int main(int argc, char **argv)
+{
+	size_t n = benchSizeArg(argc, argv, 1000000);
+	string path = argc > 2 ? argv[2] : "import_bench_roster.csv";
+
+	{
+		ofstream out(path, ios::binary);
+		out << "type,name,birthDate,units\n";
+		for (size_t i = 0; i < n; i++)
+		{
+			out << (syntheticType(i) == EmployeeType::Office ? "office" : "worker") << ','
+					<< syntheticName(i) << ',' << syntheticBirthDate(i) << ',' << syntheticUnits(i) << '\n';
+		}
+	}
+
+	double loadMs;
+	size_t loaded;
+	{
+		EmployeeManagement manager;
+		BenchTimer timer;
+		loaded = manager.importFile(path);
+		loadMs = timer.elapsedMs();
+	}
+	remove(path.c_str());
+
+	cout << "\nemployees:  " << loaded << " of " << n << "\n";
+	cout << "import:     " << loadMs << " ms (" << loadMs * 1e6 / n << " ns/employee)\n";
+	return loaded == n ? 0 : 1;
+}
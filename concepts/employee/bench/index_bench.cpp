@@ -0,0 +1,89 @@
+#include <iostream>
+#include <vector>
+#include "BenchUtil.h"
+#include "EmployeeManagement.cpp"
+
+using namespace std;
+
+// Lookup latency of the name/birth-date hash indexes and the name prefix
+// index, next to the linear getName() walk they replace.
+//
+// Usage: index_bench [employees]
+
+int main(int argc, char **argv)
+{
+	size_t n = benchSizeArg(argc, argv, 1000000);
+	const size_t queries = 100000;
+	const size_t linearQueries = 20;
+
+	EmployeeManagement manager;
+	BenchTimer build;
+	for (size_t i = 0; i < n; i++)
+	{
+		if (syntheticType(i) == EmployeeType::Office)
+		{
+			manager.createOfficeEmployee(syntheticName(i), syntheticBirthDate(i), syntheticUnits(i));
+		}
+		else
+		{
+			manager.createWorker(syntheticName(i), syntheticBirthDate(i), syntheticUnits(i));
+		}
+	}
+	double buildMs = build.elapsedMs();
+
+	vector<string> names(queries);
+	vector<string> birthDates(queries);
+	for (size_t q = 0; q < queries; q++)
+	{
+		size_t i = syntheticHash(q + n) % n;
+		names[q] = syntheticName(i);
+		birthDates[q] = syntheticBirthDate(i);
+	}
+
+	size_t found = 0;
+	BenchTimer nameTimer;
+	for (size_t q = 0; q < queries; q++)
+	{
+		found += manager.findByName(names[q]).size();
+	}
+	double nameNs = nameTimer.elapsedNs() / queries;
+
+	size_t dateHits = 0;
+	BenchTimer dateTimer;
+	for (size_t q = 0; q < queries; q++)
+	{
+		dateHits += manager.findByBirthDate(birthDates[q]).size();
+	}
+	double dateNs = dateTimer.elapsedNs() / queries;
+
+	manager.findByNamePrefix("", 1);
+	const char *prefixes[] = {"Anna S", "Chen Ok", "Hana Berg 12", "Eli Khan 9999", "Zed"};
+	size_t prefixHits = 0;
+	BenchTimer prefixTimer;
+	for (size_t q = 0; q < queries; q++)
+	{
+		prefixHits += manager.findByNamePrefix(prefixes[q % 5], 10).size();
+	}
+	double prefixNs = prefixTimer.elapsedNs() / queries;
+
+	size_t linearFound = 0;
+	BenchTimer linearTimer;
+	for (size_t q = 0; q < linearQueries; q++)
+	{
+		for (size_t i = 0; i < manager.size(); i++)
+		{
+			if (manager.getEmployee(i)->getName() == names[q])
+			{
+				linearFound++;
+			}
+		}
+	}
+	double linearNs = linearTimer.elapsedNs() / linearQueries;
+
+	cout << "employees:             " << n << " (indexed build " << buildMs << " ms)\n";
+	cout << "findByName:            " << nameNs << " ns/query (" << found << " hits)\n";
+	cout << "findByBirthDate:       " << dateNs << " ns/query (" << dateHits / queries << " rows/query)\n";
+	cout << "findByNamePrefix(10):  " << prefixNs << " ns/query (" << prefixHits << " hits)\n";
+	cout << "linear getName() walk: " << linearNs << " ns/query (" << linearFound << " hits)\n";
+	return found == queries ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include "BenchUtil.h"
+#include "EmployeeManagement.cpp"
+#include "Instrumentation.h"
+
+using namespace std;
+
+// Cost of one timed scope, then a small EmployeeManagement workload with
+// every probe live, dumped as JSON. Built with EMPLOYEE_INSTRUMENTATION
+// regardless of the build option; without it the probes compile to nothing.
+// Exits non-zero if a probe's call count is off.
+//
+// Usage: instrumentation_bench [employees]
+
+class NullBuffer : public streambuf
+{
+protected:
+	int overflow(int c) override
+	{
+		return c;
+	}
+
+	streamsize xsputn(const char *, streamsize n) override
+	{
+		return n;
+	}
+};
+
+namespace
+{
+	volatile uint64_t sink;
+
+	void bare(uint64_t i)
+	{
+		sink = i;
+	}
+
+	void timed(uint64_t i)
+	{
+		EMPLOYEE_TIMED_SCOPE(timer, "bench::timed");
+		sink = i;
+	}
+
+	uint64_t callsOf(const string &json, const string &name)
+	{
+		size_t at = json.find("\"name\":\"" + name + "\",\"calls\":");
+		if (at == string::npos)
+		{
+			return 0;
+		}
+		return stoull(json.substr(at + name.size() + 18));
+	}
+}
+
+int main(int argc, char **argv)
+{
+	size_t n = benchSizeArg(argc, argv, 1000000);
+
+	BenchTimer bareTimer;
+	for (size_t i = 0; i < n; i++)
+	{
+		bare(i);
+	}
+	double bareNs = bareTimer.elapsedNs() / n;
+
+	BenchTimer timedTimer;
+	for (size_t i = 0; i < n; i++)
+	{
+		timed(i);
+	}
+	double timedNs = timedTimer.elapsedNs() / n;
+
+	const size_t employees = 1000;
+	NullBuffer nullBuffer;
+	{
+		EmployeeManagement manager;
+		for (size_t i = 0; i < employees; i++)
+		{
+			manager.addEmployee(new Worker(syntheticName(i), syntheticBirthDate(i), syntheticUnits(i)));
+			manager.calculateTotalSalary();
+		}
+		streambuf *saved = cout.rdbuf(&nullBuffer);
+		manager.displayAll();
+		cout.rdbuf(saved);
+	}
+
+	string json = Instrumentation::toJson();
+	cout << "timed scope overhead: " << timedNs - bareNs << " ns/call\n\n";
+	cout << json << "\n";
+
+	bool ok = Instrumentation::enabled() && callsOf(json, "bench::timed") == n &&
+						callsOf(json, "EmployeeManagement::addEmployee") == employees &&
+						callsOf(json, "EmployeeManagement::calculateTotalSalary") == employees &&
+						callsOf(json, "EmployeeManagement::displayAll") == 1 &&
+						callsOf(json, "ReportRenderer::describe") == employees;
+	cout << "\ncall counts: " << (ok ? "ok" : "WRONG") << "\n";
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,150 @@
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BenchUtil.h"
+#include "ConcurrentEmployeeManagement.h"
+#include "StringPool.h"
+
+using namespace std;
+
+// Interning throughput of StringPool as writer threads are added, with a
+// single stripe (one lock, as before striping) and with STRIPES stripes.
+// Each thread interns its own new strings plus a set every thread shares;
+// the shared strings must get the same id in every thread and every view
+// must read back its string. Then ConcurrentEmployeeManagement ingest with
+// the same thread counts, which interns every name and odd birth date
+// through the shared pool.
+//
+// The gain needs as many cores as threads; the core count is printed.
+//
+// Usage: intern_bench [strings per thread] [max threads]
+
+namespace
+{
+	const size_t COMMON = 1024;
+
+	// Strings per second with t threads; ok is cleared on a failed check.
+	double internRate(size_t stripes, unsigned t, const vector<vector<string>> &own, const vector<string> &common, bool &ok)
+	{
+		StringPool pool(stripes);
+		vector<vector<uint32_t>> ownIds(t), commonIds(t);
+		vector<thread> threads;
+		BenchTimer timer;
+		for (unsigned w = 0; w < t; w++)
+		{
+			threads.emplace_back([&, w]() {
+				const vector<string> &strings = own[w];
+				ownIds[w].reserve(strings.size());
+				commonIds[w].reserve(common.size());
+				for (size_t i = 0; i < strings.size(); i++)
+				{
+					ownIds[w].push_back(pool.intern(strings[i]));
+					if (i % 64 == 0)
+					{
+						commonIds[w].push_back(pool.intern(common[(i / 64 + w * 7) % COMMON]));
+					}
+				}
+			});
+		}
+		for (thread &th : threads)
+		{
+			th.join();
+		}
+		double seconds = timer.elapsedNs() / 1e9;
+
+		size_t interned = 0;
+		for (unsigned w = 0; w < t; w++)
+		{
+			interned += own[w].size() + commonIds[w].size();
+			for (size_t i = 0; i < own[w].size() && ok; i++)
+			{
+				ok = pool.view(ownIds[w][i]) == own[w][i];
+			}
+			for (size_t k = 0; k < commonIds[w].size() && ok; k++)
+			{
+				const string &s = common[(k + w * 7) % COMMON];
+				uint32_t id;
+				ok = pool.view(commonIds[w][k]) == s && pool.find(s, id) && id == commonIds[w][k];
+			}
+		}
+		return interned / seconds;
+	}
+
+	double ingestRate(unsigned t, const vector<vector<string>> &own, const vector<string> &dates, bool &ok)
+	{
+		ConcurrentEmployeeManagement roster;
+		vector<thread> threads;
+		BenchTimer timer;
+		for (unsigned w = 0; w < t; w++)
+		{
+			threads.emplace_back([&, w]() {
+				const vector<string> &names = own[w];
+				for (size_t i = 0; i < names.size(); i++)
+				{
+					roster.addWorker(names[i], dates[i % dates.size()], 1);
+				}
+			});
+		}
+		for (thread &th : threads)
+		{
+			th.join();
+		}
+		double seconds = timer.elapsedNs() / 1e9;
+		size_t n = 0;
+		for (unsigned w = 0; w < t; w++)
+		{
+			n += own[w].size();
+		}
+		ok = ok && roster.size() == n;
+		return n / seconds;
+	}
+}
+
+int main(int argc, char **argv)
+{
+	size_t perThread = benchSizeArg(argc, argv, 200000);
+	unsigned maxThreads = argc > 2 ? static_cast<unsigned>(atoi(argv[2])) : 8;
+	maxThreads = maxThreads > 0 ? maxThreads : 1;
+
+	vector<vector<string>> own(maxThreads);
+	for (unsigned w = 0; w < maxThreads; w++)
+	{
+		for (size_t i = 0; i < perThread; i++)
+		{
+			own[w].push_back(syntheticName(w * perThread + i));
+		}
+	}
+	vector<string> common;
+	for (size_t i = 0; i < COMMON; i++)
+	{
+		common.push_back(syntheticBirthDate(i) + " common");
+	}
+	// Not dd/mm/yyyy, so the records keep them as pooled strings.
+	vector<string> dates;
+	for (size_t i = 0; i < 4096; i++)
+	{
+		dates.push_back(syntheticBirthDate(i) + "?");
+	}
+
+	printf("strings per thread: %zu, hardware threads: %u\n\n", perThread, thread::hardware_concurrency());
+	printf("%8s %16s %16s %10s %16s\n", "threads", "1 stripe", "striped", "gain", "roster ingest");
+	printf("%8s %16s %16s %10s %16s\n", "", "M strings/s", "M strings/s", "", "M rows/s");
+	bool ok = true;
+	double baseStriped = 0;
+	for (unsigned t = 1; t <= maxThreads; t *= 2)
+	{
+		double single = internRate(1, t, own, common, ok);
+		double striped = internRate(StringPool::STRIPES, t, own, common, ok);
+		double ingest = ingestRate(t, own, dates, ok);
+		if (t == 1)
+		{
+			baseStriped = striped;
+		}
+		printf("%8u %16.2f %16.2f %9.2fx %16.2f   (striped %.2fx over 1 thread)\n", t, single / 1e6, striped / 1e6,
+					 striped / single, ingest / 1e6, striped / baseStriped);
+	}
+	printf("\nids and views: %s\n", ok ? "ok" : "WRONG");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,231 @@
+#include <cstdio>
+#include <iostream>
+#include "BenchUtil.h"
+#include "EmployeeManagement.cpp"
+
+using namespace std;
+
+// Cost of a journaled mutation next to an unjournaled one and a full
+// snapshot re-save, then recovery: the journal is closed with a torn
+// record appended, reopened into a fresh manager, mutated some more and
+// recovered once again. Exits non-zero if a recovered roster differs from
+// one built without a journal, or if recovery replayed more than the
+// compaction interval allows. Finally compacts every 128 records while
+// adds keep coming and checks that a reopen recovers all of them within
+// the same bound.
+//
+// Usage: journal_bench [mutations] [base path]
+
+namespace
+{
+	// Adds employees first..first+count and, after every second add,
+	// updates the units of an earlier row.
+	void mutate(EmployeeManagement &manager, size_t first, size_t count)
+	{
+		for (size_t i = first; i < first + count; i++)
+		{
+			if (syntheticType(i) == EmployeeType::Office)
+			{
+				manager.createOfficeEmployee(syntheticName(i), syntheticBirthDate(i), syntheticUnits(i));
+			}
+			else
+			{
+				manager.createWorker(syntheticName(i), syntheticBirthDate(i), syntheticUnits(i));
+			}
+			if (i % 2 == 1)
+			{
+				size_t row = syntheticHash(i) % manager.size();
+				int units = syntheticUnits(i ^ 0x5555);
+				if (!manager.setWorkingDays(row, units))
+				{
+					manager.setNoOfProducts(row, units);
+				}
+			}
+		}
+	}
+
+	bool sameRoster(const EmployeeManagement &a, const EmployeeManagement &b)
+	{
+		const EmployeeColumns &x = a.getColumns();
+		const EmployeeColumns &y = b.getColumns();
+		if (x.size() != y.size())
+		{
+			return false;
+		}
+		for (size_t i = 0; i < x.size(); i++)
+		{
+			if (x.typeAt(i) != y.typeAt(i) || x.unitsAt(i) != y.unitsAt(i) ||
+					x.nameAt(i) != y.nameAt(i) || x.birthDateAt(i) != y.birthDateAt(i))
+			{
+				return false;
+			}
+		}
+		return a.getTotals().totalSalary() == b.getTotals().totalSalary();
+	}
+
+	void removeFiles(const string &base)
+	{
+		remove((base + ".snap").c_str());
+		remove((base + ".journal").c_str());
+		remove((base + ".journal.old").c_str());
+	}
+
+	// Reopens base into manager and reports how long it took.
+	bool recover(EmployeeManagement &manager, const string &base, const RosterJournal::Options &options, const char *label)
+	{
+		string error;
+		BenchTimer timer;
+		if (!manager.openJournal(base, options, error))
+		{
+			cerr << error << "\n";
+			return false;
+		}
+		double ms = timer.elapsedMs();
+		RosterJournal *journal = manager.getJournal();
+		printf("%-22s %9.2f ms  %zu employees, %zu records replayed, %zu torn bytes dropped\n",
+					 label, ms, manager.size(), journal->getReplayedRecords(), journal->getDiscardedBytes());
+		return true;
+	}
+}
+
+int main(int argc, char **argv)
+{
+	size_t n = benchSizeArg(argc, argv, 400000);
+	string base = argc > 2 ? argv[2] : "journal_bench.roster";
+	size_t mutations = n + n / 2;
+
+	RosterJournal::Options options;
+	options.compactEvery = n / 4 > 0 ? n / 4 : 1;
+	removeFiles(base);
+
+	EmployeeManagement reference;
+	BenchTimer plainTimer;
+	mutate(reference, 0, n);
+	double plainNs = plainTimer.elapsedNs() / mutations;
+
+	// Group commit alone, then with compaction running behind it.
+	RosterJournal::Options appendOnly = options;
+	appendOnly.compactEvery = SIZE_MAX;
+	double appendNs, journaledNs, commitMs;
+	size_t groupWrites, compactions;
+	{
+		EmployeeManagement manager;
+		removeFiles(base + ".append");
+		if (!recover(manager, base + ".append", appendOnly, "open, no compaction"))
+		{
+			return 1;
+		}
+		BenchTimer timer;
+		mutate(manager, 0, n);
+		appendNs = timer.elapsedNs() / mutations;
+	}
+	removeFiles(base + ".append");
+	{
+		EmployeeManagement manager;
+		if (!recover(manager, base, options, "open empty journal"))
+		{
+			return 1;
+		}
+		BenchTimer timer;
+		mutate(manager, 0, n);
+		journaledNs = timer.elapsedNs() / mutations;
+		BenchTimer commitTimer;
+		if (!manager.commitJournal())
+		{
+			cerr << manager.getJournal()->getError() << "\n";
+			return 1;
+		}
+		commitMs = commitTimer.elapsedMs();
+		groupWrites = manager.getJournal()->getGroupWrites();
+		compactions = manager.getJournal()->getCompactions();
+	}
+
+	string error;
+	BenchTimer resaveTimer;
+	if (!RosterSnapshot::write(base + ".resave", reference.getColumns(), error))
+	{
+		cerr << error << "\n";
+		return 1;
+	}
+	double resaveMs = resaveTimer.elapsedMs();
+	remove((base + ".resave").c_str());
+
+	printf("\n%zu mutations (%zu adds, %zu unit updates), compaction every %zu records\n",
+				 mutations, n, n / 2, options.compactEvery);
+	printf("unjournaled mutation   %9.1f ns\n", plainNs);
+	printf("journaled, no compact  %9.1f ns\n", appendNs);
+	printf("journaled mutation     %9.1f ns  (%zu group writes, %zu compactions done)\n", journaledNs, groupWrites, compactions);
+	printf("final commit           %9.2f ms\n", commitMs);
+	printf("full re-save           %9.2f ms  (what every mutation would cost without a journal)\n\n", resaveMs);
+
+	// Simulate a crash part-way through a record.
+	FILE *file = fopen((base + ".journal").c_str(), "ab");
+	const char torn[10] = {40, 0, 0, 0, 1, 2, 3, 4, 1, 0};
+	fwrite(torn, 1, sizeof(torn), file);
+	fclose(file);
+
+	bool ok = true;
+	size_t bound = 2 * options.compactEvery;
+	{
+		EmployeeManagement manager;
+		if (!recover(manager, base, options, "recover"))
+		{
+			return 1;
+		}
+		RosterJournal *journal = manager.getJournal();
+		ok = ok && sameRoster(manager, reference) && journal->getDiscardedBytes() == sizeof(torn) &&
+				 journal->getReplayedRecords() <= bound;
+
+		mutate(manager, n, n / 4);
+		mutate(reference, n, n / 4);
+	}
+	{
+		EmployeeManagement manager;
+		if (!recover(manager, base, options, "recover after more"))
+		{
+			return 1;
+		}
+		RosterJournal *journal = manager.getJournal();
+		ok = ok && sameRoster(manager, reference) && journal->getDiscardedBytes() == 0 &&
+				 journal->getReplayedRecords() <= bound;
+	}
+	removeFiles(base);
+
+	// Compactions racing the adds: each one must keep the records logged
+	// after its rotation point, and however far the compactor falls behind,
+	// a reopen replays at most two intervals. The journal is reopened after
+	// every round, so records lost by the last compaction of a round show
+	// up.
+	RosterJournal::Options busy = options;
+	busy.compactEvery = 128;
+	const size_t rounds = 10;
+	const size_t roundAdds = 2000;
+	size_t busyCompactions = 0;
+	EmployeeManagement expected;
+	for (size_t r = 0; r < rounds && ok; r++)
+	{
+		EmployeeManagement manager;
+		if (!recover(manager, base, busy, r == 0 ? "open, compact every 128" : "reopen busy journal"))
+		{
+			return 1;
+		}
+		ok = ok && sameRoster(manager, expected) && manager.getJournal()->getReplayedRecords() <= 2 * busy.compactEvery;
+		mutate(manager, r * roundAdds, roundAdds);
+		mutate(expected, r * roundAdds, roundAdds);
+		ok = ok && manager.commitJournal();
+		busyCompactions += manager.getJournal()->getCompactions();
+	}
+	{
+		EmployeeManagement manager;
+		if (!recover(manager, base, busy, "recover busy journal"))
+		{
+			return 1;
+		}
+		ok = ok && sameRoster(manager, expected) && manager.getJournal()->getReplayedRecords() <= 2 * busy.compactEvery;
+	}
+	removeFiles(base);
+	printf("%zu compactions while adding\n", busyCompactions);
+
+	printf("\nrecovered rosters: %s (replay bound %zu records)\n", ok ? "ok" : "WRONG", bound);
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,62 @@
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include "BenchUtil.h"
+#include "ParallelPayroll.h"
+
+using namespace std;
+
+// Scaling of the parallel payroll reduction from 1 to N threads, and a
+// check that every thread count produces a bit-identical total.
+//
+// Usage: parallel_bench [employees] [maxThreads]
+
+int main(int argc, char **argv)
+{
+	size_t n = benchSizeArg(argc, argv, 10000000);
+	unsigned maxThreads = argc > 2 ? static_cast<unsigned>(atoi(argv[2])) : thread::hardware_concurrency();
+	if (maxThreads == 0)
+	{
+		maxThreads = 1;
+	}
+	const int reps = 10;
+
+	EmployeeColumns columns;
+	columns.reserve(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		columns.add(syntheticType(i), "", "", syntheticUnits(i));
+	}
+
+	cout << "employees: " << n << "\n";
+	cout << "threads  ms/total  speedup  total\n";
+
+	double baseMs = 0;
+	double reference = 0;
+	bool identical = true;
+	for (unsigned t = 1; t <= maxThreads; t++)
+	{
+		ParallelPayroll payroll(t);
+		double total = 0;
+		BenchTimer timer;
+		for (int r = 0; r < reps; r++)
+		{
+			total = payroll.totalSalary(columns);
+		}
+		double ms = timer.elapsedMs() / reps;
+		if (t == 1)
+		{
+			baseMs = ms;
+			reference = total;
+		}
+		else if (memcmp(&total, &reference, sizeof(double)) != 0)
+		{
+			identical = false;
+		}
+		cout << t << "\t " << ms << "\t   " << baseMs / ms << "x\t    " << static_cast<int64_t>(total) << "\n";
+	}
+
+	cout << "bit-identical across thread counts: " << (identical ? "yes" : "NO") << "\n";
+	return identical ? 0 : 1;
+}
@@ -0,0 +1,150 @@
+#include <iostream>
+#include <vector>
+#include "BenchUtil.h"
+#include "EmployeeColumns.h"
+#include "OfficeEmployee.h"
+#include "PayPolicy.h"
+#include "Worker.h"
+
+using namespace std;
+
+// Payroll under compile-time pay schedules against the virtual
+// calculateSalary() path, and tiered schedules against the same tiers
+// interpreted from a runtime table.
+//
+// Usage: pay_policy_bench [employees]
+
+namespace
+{
+	struct RuntimeTier
+	{
+		int from;
+		int rate;
+	};
+
+	// What a data-driven schedule costs: the tier table is walked per row.
+	int64_t interpretedPay(const vector<RuntimeTier> &tiers, int units)
+	{
+		int64_t pay = 0;
+		for (size_t t = 0; t < tiers.size(); t++)
+		{
+			int to = t + 1 < tiers.size() ? tiers[t + 1].from : units;
+			if (units > tiers[t].from)
+			{
+				pay += static_cast<int64_t>(min(units, to) - tiers[t].from) * tiers[t].rate;
+			}
+		}
+		return pay;
+	}
+}
+
+int main(int argc, char **argv)
+{
+	size_t n = benchSizeArg(argc, argv, 1000000);
+	const int reps = 20;
+
+	vector<Employee *> pointers;
+	pointers.reserve(n);
+	EmployeeColumns columns;
+	columns.reserve(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		string name = syntheticName(i);
+		string birthDate = syntheticBirthDate(i);
+		int units = syntheticUnits(i);
+		if (syntheticType(i) == EmployeeType::Office)
+		{
+			pointers.push_back(new OfficeEmployee(name, birthDate, units));
+		}
+		else
+		{
+			pointers.push_back(new Worker(name, birthDate, units));
+		}
+		columns.add(syntheticType(i), pointers.back()->getNameId(), pointers.back()->getBirthDateId(), units);
+	}
+	const EmployeeType *types = columns.types();
+	const int32_t *units = columns.units();
+
+	double virtualTotal = 0;
+	BenchTimer virtualTimer;
+	for (int r = 0; r < reps; r++)
+	{
+		double total = 0;
+		for (Employee *e : pointers)
+		{
+			total += e->calculateSalary();
+		}
+		virtualTotal = total;
+	}
+	double virtualNs = virtualTimer.elapsedNs() / reps / n;
+
+	int64_t compiledTotal = 0;
+	BenchTimer compiledTimer;
+	for (int r = 0; r < reps; r++)
+	{
+		compiledTotal = StandardSchedule::sumSalary(types, units, 0, n);
+	}
+	double compiledNs = compiledTimer.elapsedNs() / reps / n;
+
+	cout << "employees:               " << n << "\n";
+	cout << "virtual (standard):      " << virtualNs << " ns/employee\n";
+	cout << "StandardSchedule inline: " << compiledNs << " ns/employee (" << virtualNs / compiledNs << "x)\n";
+	bool ok = virtualTotal == static_cast<double>(compiledTotal);
+
+	vector<RuntimeTier> officeTiers[3] = {{{0, 1000}}, {{0, 1000}, {22, 1500}}, {{0, 1000}}};
+	vector<RuntimeTier> workerTiers[3] = {{{0, 5000}}, {{0, 5000}}, {{0, 5000}, {100, 5500}, {150, 6000}}};
+	for (size_t p = 0; p < PayPolicy::count(); p++)
+	{
+		const PayPolicy &policy = PayPolicy::all()[p];
+
+		int64_t dispatchedTotal = 0;
+		BenchTimer dispatchedTimer;
+		for (int r = 0; r < reps; r++)
+		{
+			dispatchedTotal = policy.sumSalary(types, units, 0, n);
+		}
+		double dispatchedNs = dispatchedTimer.elapsedNs() / reps / n;
+
+		int64_t perRowTotal = 0;
+		BenchTimer perRowTimer;
+		for (int r = 0; r < reps; r++)
+		{
+			int64_t total = 0;
+			for (size_t i = 0; i < n; i++)
+			{
+				total += policy.salaryOf(types[i], units[i]);
+			}
+			perRowTotal = total;
+		}
+		double perRowNs = perRowTimer.elapsedNs() / reps / n;
+
+		int64_t interpretedTotal = 0;
+		BenchTimer interpretedTimer;
+		for (int r = 0; r < reps; r++)
+		{
+			int64_t total = 0;
+			for (size_t i = 0; i < n; i++)
+			{
+				total += interpretedPay(types[i] == EmployeeType::Office ? officeTiers[p] : workerTiers[p], units[i]);
+			}
+			interpretedTotal = total;
+		}
+		double interpretedNs = interpretedTimer.elapsedNs() / reps / n;
+
+		bool match = dispatchedTotal == perRowTotal && dispatchedTotal == interpretedTotal;
+		ok = ok && match;
+		cout << "\n" << policy.name << " (" << policy.description << ")\n";
+		cout << "  per-scan dispatch:     " << dispatchedNs << " ns/employee\n";
+		cout << "  per-row dispatch:      " << perRowNs << " ns/employee\n";
+		cout << "  interpreted tiers:     " << interpretedNs << " ns/employee (" << interpretedNs / dispatchedNs << "x)\n";
+		cout << "  payroll:               " << dispatchedTotal << (match ? "" : " MISMATCH") << "\n";
+	}
+
+	cout << "\ntotals match:            " << (ok ? "yes" : "NO") << "\n";
+
+	for (Employee *e : pointers)
+	{
+		delete e;
+	}
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,117 @@
+#include <iomanip>
+#include <iostream>
+#include <streambuf>
+#include <vector>
+#include "BenchUtil.h"
+#include "EmployeeManagement.cpp"
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+using namespace std;
+
+// End-to-end baseline for EmployeeManagement on synthetic rosters of
+// 1e3, 1e4, ... up to maxEmployees: insert throughput, calculateTotalSalary(),
+// displayAll() into a null sink, and destruction, each in ns/employee,
+// plus the process peak RSS after each size.
+//
+// Usage: payroll_bench [maxEmployees]
+
+class NullBuffer : public streambuf
+{
+protected:
+	int overflow(int c) override
+	{
+		return c;
+	}
+
+	streamsize xsputn(const char *, streamsize n) override
+	{
+		return n;
+	}
+};
+
+static double peakRssMb()
+{
+#ifndef _WIN32
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	return usage.ru_maxrss / 1024.0; // kilobytes on Linux
+#else
+	return 0;
+#endif
+}
+
+int main(int argc, char **argv)
+{
+	size_t maxEmployees = benchSizeArg(argc, argv, 10000000);
+
+	// A fixed pool of distinct strings keeps generation out of the timings.
+	// Employee i pairs name i % distinct with birth date i / distinct, so no
+	// two share both and the manager drops none as duplicates.
+	const size_t distinct = 65536;
+	vector<string> names(distinct);
+	vector<string> birthDates(distinct);
+	int32_t firstDay = BirthDate::fromCivil(1900, 1, 1);
+	for (size_t i = 0; i < distinct; i++)
+	{
+		names[i] = syntheticName(i);
+		birthDates[i] = BirthDate::format(firstDay + static_cast<int32_t>(i));
+	}
+
+	NullBuffer nullBuffer;
+
+	cout << setw(10) << "employees" << setw(12) << "insert" << setw(12) << "total"
+			 << setw(12) << "display" << setw(12) << "destroy" << setw(12) << "peak RSS" << "\n";
+	cout << setw(10) << "" << setw(12) << "ns/emp" << setw(12) << "ns/emp"
+			 << setw(12) << "ns/emp" << setw(12) << "ns/emp" << setw(12) << "MB" << "\n";
+
+	for (size_t n = 1000; n <= maxEmployees; n *= 10)
+	{
+		EmployeeManagement *manager = new EmployeeManagement();
+
+		BenchTimer insert;
+		for (size_t i = 0; i < n; i++)
+		{
+			const string &name = names[i % distinct];
+			const string &birthDate = birthDates[i / distinct % distinct];
+			if (syntheticType(i) == EmployeeType::Office)
+			{
+				manager->createOfficeEmployee(name, birthDate, syntheticUnits(i));
+			}
+			else
+			{
+				manager->createWorker(name, birthDate, syntheticUnits(i));
+			}
+		}
+		double insertNs = insert.elapsedNs() / n;
+
+		const int totalReps = 100;
+		double sink = 0;
+		BenchTimer total;
+		for (int r = 0; r < totalReps; r++)
+		{
+			sink += manager->calculateTotalSalary();
+		}
+		double totalNs = total.elapsedNs() / totalReps / n;
+
+		streambuf *saved = cout.rdbuf(&nullBuffer);
+		BenchTimer display;
+		manager->displayAll();
+		double displayNs = display.elapsedNs() / n;
+		cout.rdbuf(saved);
+
+		BenchTimer destroy;
+		delete manager;
+		double destroyNs = destroy.elapsedNs() / n;
+
+		cout << setw(10) << n << setw(12) << insertNs << setw(12) << totalNs
+				 << setw(12) << displayNs << setw(12) << destroyNs << setw(12) << peakRssMb() << "\n";
+		if (sink < 0)
+		{
+			return 1;
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,113 @@
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <streambuf>
+#include "BenchUtil.h"
+#include "EmployeeManagement.cpp"
+#include "PayrollPipeline.h"
+
+using namespace std;
+
+// A payroll run over a synthetic CSV roster, done today's way (import,
+// calculateTotalSalary(), displayAll() one after another on one thread)
+// and through the four-stage PayrollPipeline, both writing to a null
+// sink. Prints each stage's busy time: with the stages overlapped, the
+// run should take about as long as the slowest stage rather than the sum.
+// Both must accept and reject exactly the same lines.
+//
+// Usage: pipeline_bench [employees] [path]
+
+class NullBuffer : public streambuf
+{
+protected:
+	int overflow(int c) override
+	{
+		return c;
+	}
+
+	streamsize xsputn(const char *, streamsize n) override
+	{
+		return n;
+	}
+};
+
+int main(int argc, char **argv)
+{
+	size_t n = benchSizeArg(argc, argv, 1000000);
+	string path = argc > 2 ? argv[2] : "pipeline_bench_roster.csv";
+
+	// Every 997th line has a malformed units field and every 1009th negative
+	// units; both must be rejected. Every 1013th birth date is not
+	// dd/mm/yyyy, which the importer keeps as written.
+	size_t malformed = 0;
+	{
+		ofstream out(path, ios::binary);
+		out << "type,name,birthDate,units\n";
+		for (size_t i = 0; i < n; i++)
+		{
+			out << (syntheticType(i) == EmployeeType::Office ? "office" : "worker") << ','
+					<< syntheticName(i) << ',' << (i % 1013 == 1012 ? "1990-01-01" : syntheticBirthDate(i)) << ',';
+			if (i % 997 == 996)
+			{
+				out << "x\n";
+				malformed++;
+			}
+			else if (i % 1009 == 1008)
+			{
+				out << "-" << syntheticUnits(i) + 1 << '\n';
+				malformed++;
+			}
+			else
+			{
+				out << syntheticUnits(i) << '\n';
+			}
+		}
+	}
+
+	NullBuffer nullBuffer;
+	ostream sink(&nullBuffer);
+
+	double sequentialMs;
+	double expectedTotal;
+	size_t imported;
+	{
+		EmployeeManagement manager;
+		streambuf *saved = cout.rdbuf(&nullBuffer);
+		BenchTimer timer;
+		imported = manager.importFile(path);
+		expectedTotal = manager.calculateTotalSalary();
+		manager.displayAll();
+		sequentialMs = timer.elapsedMs();
+		cout.rdbuf(saved);
+	}
+
+	PayrollPipeline pipeline(sink);
+	if (!pipeline.run(path))
+	{
+		cout << pipeline.getError() << "\n";
+		remove(path.c_str());
+		return 1;
+	}
+	remove(path.c_str());
+	const PipelineStats &stats = pipeline.getStats();
+
+	double sumMs = 0;
+	double slowestMs = 0;
+	cout << "employees:     " << n << "\n";
+	cout << "sequential:    " << sequentialMs << " ms\n";
+	cout << "pipeline:      " << stats.elapsedMs << " ms (" << sequentialMs / stats.elapsedMs << "x)\n";
+	cout << "stage        busy ms  output full  input empty\n";
+	for (int s = 0; s < PipelineStats::STAGES; s++)
+	{
+		sumMs += stats.busyMs[s];
+		slowestMs = max(slowestMs, stats.busyMs[s]);
+		printf("%-10s %9.2f %12zu %12zu\n", PipelineStats::stageName(s), stats.busyMs[s], stats.fullWaits[s],
+					 stats.emptyWaits[s]);
+	}
+	cout << "sum of stages: " << sumMs << " ms, slowest: " << slowestMs << " ms\n";
+
+	bool ok = stats.rows == n - malformed && imported == stats.rows && stats.rejected == malformed &&
+						static_cast<double>(stats.totalSalary) == expectedTotal;
+	cout << "rows " << stats.rows << ", rejected " << stats.rejected << ", totals match: " << (ok ? "yes" : "NO") << "\n";
+	return ok ? 0 : 1;
+}
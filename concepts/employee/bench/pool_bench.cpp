@@ -0,0 +1,141 @@
+#include <iostream>
+#include <vector>
+#include "BenchUtil.h"
+#include "EmployeeManagement.cpp"
+
+using namespace std;
+
+// Compares a list of individually new'd employees, deleted one by one,
+// with the same employees built in SlabPools, for build and teardown time.
+// Then times the manager, which keeps its employees in those pools, building
+// the roster through createOfficeEmployee/createWorker.
+//
+// Usage: pool_bench [employees]
+
+struct RunResult
+{
+	double buildMs;
+	double teardownMs;
+	double bytesPerEmployee;
+};
+
+static RunResult runHeap(const vector<string> &names, const vector<string> &birthDates)
+{
+	RunResult result;
+	size_t n = names.size();
+	vector<Employee *> employees;
+
+	BenchTimer build;
+	employees.reserve(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		int units = syntheticUnits(i);
+		if (syntheticType(i) == EmployeeType::Office)
+		{
+			employees.push_back(new OfficeEmployee(names[i], birthDates[i], units));
+		}
+		else
+		{
+			employees.push_back(new Worker(names[i], birthDates[i], units));
+		}
+	}
+	result.buildMs = build.elapsedMs();
+	result.bytesPerEmployee = 0;
+
+	BenchTimer teardown;
+	for (Employee *e : employees)
+	{
+		delete e;
+	}
+	result.teardownMs = teardown.elapsedMs();
+	return result;
+}
+
+static RunResult runSlab(const vector<string> &names, const vector<string> &birthDates)
+{
+	RunResult result;
+	size_t n = names.size();
+	SlabPool<OfficeEmployee> *officePool = new SlabPool<OfficeEmployee>();
+	SlabPool<Worker> *workerPool = new SlabPool<Worker>();
+	vector<Employee *> employees;
+
+	BenchTimer build;
+	employees.reserve(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		int units = syntheticUnits(i);
+		if (syntheticType(i) == EmployeeType::Office)
+		{
+			employees.push_back(officePool->create(names[i], birthDates[i], units));
+		}
+		else
+		{
+			employees.push_back(workerPool->create(names[i], birthDates[i], units));
+		}
+	}
+	result.buildMs = build.elapsedMs();
+	result.bytesPerEmployee = static_cast<double>(officePool->bytesReserved() + workerPool->bytesReserved()) / n;
+
+	BenchTimer teardown;
+	delete officePool;
+	delete workerPool;
+	result.teardownMs = teardown.elapsedMs();
+	return result;
+}
+
+static RunResult runManager(const vector<string> &names, const vector<string> &birthDates)
+{
+	RunResult result;
+	size_t n = names.size();
+	EmployeeManagement *manager = new EmployeeManagement();
+
+	BenchTimer build;
+	for (size_t i = 0; i < n; i++)
+	{
+		int units = syntheticUnits(i);
+		if (syntheticType(i) == EmployeeType::Office)
+		{
+			manager->createOfficeEmployee(names[i], birthDates[i], units);
+		}
+		else
+		{
+			manager->createWorker(names[i], birthDates[i], units);
+		}
+	}
+	result.buildMs = build.elapsedMs();
+	result.bytesPerEmployee = manager->bytesPerEmployee();
+
+	BenchTimer teardown;
+	delete manager;
+	result.teardownMs = teardown.elapsedMs();
+	return result;
+}
+
+int main(int argc, char **argv)
+{
+	size_t n = benchSizeArg(argc, argv, 1000000);
+
+	vector<string> names(n);
+	vector<string> birthDates(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		names[i] = syntheticName(i);
+		birthDates[i] = syntheticBirthDate(i);
+	}
+
+	RunResult heap = runHeap(names, birthDates);
+	RunResult pool = runSlab(names, birthDates);
+	RunResult manager = runManager(names, birthDates);
+
+	cout << "employees:            " << n << "\n";
+	cout << "new/delete build:     " << heap.buildMs << " ms\n";
+	cout << "new/delete teardown:  " << heap.teardownMs << " ms\n";
+	cout << "slab pool build:      " << pool.buildMs << " ms\n";
+	cout << "slab pool teardown:   " << pool.teardownMs << " ms\n";
+	cout << "pool bytes/employee:  " << pool.bytesPerEmployee << " (objects " << sizeof(OfficeEmployee) << "/"
+			 << sizeof(Worker) << " B)\n";
+	cout << "manager build:        " << manager.buildMs << " ms (pools, columns, index, duplicate filter)\n";
+	cout << "manager teardown:     " << manager.teardownMs << " ms\n";
+	cout << "manager bytes/emp:    " << manager.bytesPerEmployee << " (pools + pointer + columns)\n";
+	return 0;
+}
@@ -0,0 +1,111 @@
+#include <cstdio>
+#include <vector>
+#include "BenchUtil.h"
+#include "PayrollScenarios.h"
+
+using namespace std;
+
+// A grid of what-if scenarios (rates, overtime thresholds, minimum pay and
+// headcount) evaluated three ways: one evaluate() pass per scenario, and
+// PayrollScenarios::run() on one thread and on every hardware thread.
+// Exits non-zero if any result differs or the standard scenario does not
+// reproduce the roster's payroll, or if run() loses precision on a roster
+// whose payroll is far beyond what a double holds exactly.
+//
+// Usage: scenario_bench [employees] [scenarios]
+
+namespace
+{
+	bool extremeUnitsExact()
+	{
+		// About 2e15 per employee and 4e18 per type, well past 2^53.
+		EmployeeColumns columns;
+		for (int i = 0; i < 4096; i++)
+		{
+			columns.add(i % 2 ? EmployeeType::Worker : EmployeeType::Office, "Extreme " + to_string(i), "01/01/1990",
+									2000000000 + i);
+		}
+		PayrollScenario scenario;
+		scenario.office.rate = 1000003;
+		scenario.office.overtimeFrom = 1000000000;
+		scenario.office.overtimeRate = 1000005;
+		scenario.worker.rate = 999983;
+		scenario.worker.minimumPay = 1;
+		PayrollScenarios scenarios(1);
+		scenarios.add(scenario);
+		ScenarioResult r = scenarios.run(columns)[0];
+		ScenarioResult e = PayrollScenarios::evaluate(scenario, columns);
+		return r.officePay == e.officePay && r.workerPay == e.workerPay;
+	}
+}
+
+int main(int argc, char **argv)
+{
+	size_t n = benchSizeArg(argc, argv, 1000000);
+	size_t count = argc > 2 ? static_cast<size_t>(atoi(argv[2])) : 256;
+
+	EmployeeColumns columns;
+	columns.reserve(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		columns.add(syntheticType(i), syntheticName(i), syntheticBirthDate(i), syntheticUnits(i));
+	}
+
+	// Scenario 0 is today's pay; the rest walk a grid of changes.
+	PayrollScenarios serial(1);
+	PayrollScenarios parallel;
+	for (size_t s = 0; s < count; s++)
+	{
+		PayrollScenario scenario;
+		scenario.name = "grid " + to_string(s);
+		if (s > 0)
+		{
+			scenario.office.rate = OfficeEmployee::DAILY_RATE + static_cast<int>(s % 8) * 50;
+			scenario.worker.rate = Worker::PRODUCT_RATE + static_cast<int>(s / 8 % 8) * 250;
+			scenario.office.overtimeFrom = 20;
+			scenario.office.overtimeRate = scenario.office.rate * 3 / 2;
+			scenario.worker.minimumPay = static_cast<int64_t>(s % 4) * 20000;
+			scenario.worker.headcount = 1.0 + static_cast<double>(s / 64) * 0.05;
+		}
+		serial.add(scenario);
+		parallel.add(scenario);
+	}
+
+	BenchTimer passTimer;
+	vector<ScenarioResult> expected(count);
+	for (size_t s = 0; s < count; s++)
+	{
+		expected[s] = PayrollScenarios::evaluate(serial.at(s), columns);
+	}
+	double passMs = passTimer.elapsedMs();
+
+	BenchTimer serialTimer;
+	vector<ScenarioResult> serialResults = serial.run(columns);
+	double serialMs = serialTimer.elapsedMs();
+
+	BenchTimer parallelTimer;
+	vector<ScenarioResult> parallelResults = parallel.run(columns);
+	double parallelMs = parallelTimer.elapsedMs();
+
+	bool ok = count == 0 || expected[0].officePay + expected[0].workerPay == columns.sumSalary(0, n);
+	for (size_t s = 0; s < count; s++)
+	{
+		const ScenarioResult &e = expected[s];
+		for (const vector<ScenarioResult> *results : {&serialResults, &parallelResults})
+		{
+			const ScenarioResult &r = (*results)[s];
+			ok = ok && r.officePay == e.officePay && r.workerPay == e.workerPay && r.totalSalary == e.totalSalary;
+		}
+	}
+
+	printf("employees: %zu, scenarios: %zu, threads: %u\n", n, count, parallel.getThreads());
+	printf("one pass per scenario: %10.1f ms  (%.2f ns/employee-scenario)\n", passMs, passMs * 1e6 / n / count);
+	printf("batched, 1 thread:     %10.1f ms  (%.2f ns/employee-scenario, %.1fx)\n", serialMs, serialMs * 1e6 / n / count,
+				 passMs / serialMs);
+	printf("batched, %2u threads:   %10.1f ms  (%.2f ns/employee-scenario, %.1fx)\n", parallel.getThreads(), parallelMs,
+				 parallelMs * 1e6 / n / count, passMs / parallelMs);
+	bool extremeOk = extremeUnitsExact();
+	printf("results match:         %s\n", ok ? "yes" : "NO");
+	printf("extreme units exact:   %s\n", extremeOk ? "yes" : "NO");
+	return ok && extremeOk ? 0 : 1;
+}
@@ -0,0 +1,79 @@
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include "BenchUtil.h"
+#include "EmployeeManagement.cpp"
+#include "ScriptRunner.h"
+
+using namespace std;
+
+// Throughput of the headless command mode on a generated script: mostly
+// register commands, with a total every 20 commands and a name query
+// every 50, then a script of nothing but totals, which is mostly parsing
+// and dispatch. Output goes to a null sink. Exits non-zero if any command
+// fails.
+//
+// Usage: script_bench [commands]
+
+class NullBuffer : public streambuf
+{
+protected:
+	int overflow(int c) override
+	{
+		return c;
+	}
+
+	streamsize xsputn(const char *, streamsize n) override
+	{
+		return n;
+	}
+};
+
+int main(int argc, char **argv)
+{
+	size_t n = benchSizeArg(argc, argv, 1000000);
+
+	string script = "# generated by script_bench\n";
+	size_t registered = 0;
+	for (size_t i = 0; i < n; i++)
+	{
+		if (i % 50 == 49)
+		{
+			script += "query name \"" + syntheticName(i / 2) + "\"\n";
+		}
+		else if (i % 20 == 19)
+		{
+			script += "total\n";
+		}
+		else
+		{
+			script += syntheticType(i) == EmployeeType::Office ? "register office \"" : "register worker \"";
+			script += syntheticName(i) + "\" " + syntheticBirthDate(i) + " " + to_string(syntheticUnits(i)) + "\n";
+			registered++;
+		}
+	}
+
+	NullBuffer nullBuffer;
+	ostream sink(&nullBuffer);
+	EmployeeManagement manager;
+	ScriptRunner runner(manager, sink, cerr);
+	BenchTimer timer;
+	size_t failed = runner.run(script);
+	double ms = timer.elapsedMs();
+
+	string totals;
+	for (size_t i = 0; i < n; i++)
+	{
+		totals += "total\n";
+	}
+	ScriptRunner totalsRunner(manager, sink, cerr);
+	BenchTimer totalsTimer;
+	failed += totalsRunner.run(totals);
+	double totalsMs = totalsTimer.elapsedMs();
+
+	cout << "commands:  " << runner.getCommands() << " (" << script.size() / 1024 << " KiB)\n";
+	cout << "mixed:     " << ms << " ms, " << runner.getCommands() / ms << " commands/ms\n";
+	cout << "totals:    " << totalsMs << " ms, " << totalsRunner.getCommands() / totalsMs << " commands/ms\n";
+	cout << "failed:    " << failed << "\n";
+	return failed == 0 && runner.getCommands() == n && manager.size() == registered ? 0 : 1;
+}
@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+#include "BenchUtil.h"
+#include "EmployeeManagement.cpp"
+
+using namespace std;
+
+// Sorted views of a synthetic roster: the radix-sorted salary and birth
+// date orders against std::stable_sort with a comparator, the name order,
+// a cached second request, and topEarners() against sorting everything.
+// Then raises one employee's units and checks that the salary order was
+// invalidated and the name order was not. Exits non-zero on any mismatch.
+//
+// Usage: sort_bench [employees] [top n]
+
+int main(int argc, char **argv)
+{
+	size_t n = benchSizeArg(argc, argv, 1000000);
+	size_t topN = argc > 2 ? static_cast<size_t>(atoi(argv[2])) : 100;
+
+	EmployeeManagement manager;
+	for (size_t i = 0; i < n; i++)
+	{
+		if (syntheticType(i) == EmployeeType::Office)
+		{
+			manager.createOfficeEmployee(syntheticName(i), syntheticBirthDate(i), syntheticUnits(i));
+		}
+		else
+		{
+			manager.createWorker(syntheticName(i), syntheticBirthDate(i), syntheticUnits(i));
+		}
+	}
+	const EmployeeColumns &columns = manager.getColumns();
+	bool ok = true;
+
+	// Reference orders from a comparison sort.
+	auto reference = [&](SortKey key) {
+		vector<uint32_t> rows(n);
+		for (size_t i = 0; i < n; i++)
+		{
+			rows[i] = static_cast<uint32_t>(i);
+		}
+		stable_sort(rows.begin(), rows.end(), [&](uint32_t a, uint32_t b) {
+			if (key == SortKey::Salary)
+			{
+				return columns.salaryAt(a) > columns.salaryAt(b);
+			}
+			return columns.birthDayAt(a) < columns.birthDayAt(b);
+		});
+		return rows;
+	};
+
+	BenchTimer salaryTimer;
+	vector<uint32_t> bySalary = manager.sortedRows(SortKey::Salary);
+	double salaryMs = salaryTimer.elapsedMs();
+	BenchTimer salaryRefTimer;
+	ok = ok && bySalary == reference(SortKey::Salary);
+	double salaryRefMs = salaryRefTimer.elapsedMs();
+
+	BenchTimer dateTimer;
+	vector<uint32_t> byDate = manager.sortedRows(SortKey::BirthDate);
+	double dateMs = dateTimer.elapsedMs();
+	BenchTimer dateRefTimer;
+	ok = ok && byDate == reference(SortKey::BirthDate);
+	double dateRefMs = dateRefTimer.elapsedMs();
+
+	BenchTimer nameTimer;
+	const vector<uint32_t> &byName = manager.sortedRows(SortKey::Name);
+	double nameMs = nameTimer.elapsedMs();
+	for (size_t i = 1; i < n && ok; i++)
+	{
+		ok = columns.nameAt(byName[i - 1]) <= columns.nameAt(byName[i]);
+	}
+
+	BenchTimer cachedTimer;
+	manager.sortedRows(SortKey::Salary);
+	double cachedUs = cachedTimer.elapsedNs() / 1e3;
+
+	// topEarners() with and without a cached salary order.
+	if (columns.typeAt(0) == EmployeeType::Office)
+	{
+		manager.setWorkingDays(0, columns.unitsAt(0));
+	}
+	else
+	{
+		manager.setNoOfProducts(0, columns.unitsAt(0));
+	}
+	ok = ok && !manager.getOrder().isCached(SortKey::Salary);
+	BenchTimer topTimer;
+	vector<size_t> top = manager.topEarners(topN);
+	double topMs = topTimer.elapsedMs();
+	ok = ok && top.size() == min(topN, n) && equal(top.begin(), top.end(), bySalary.begin());
+
+	// A raise for the last office employee puts them first by salary.
+	size_t raised = n;
+	for (size_t i = n; i-- > 0;)
+	{
+		if (columns.typeAt(i) == EmployeeType::Office)
+		{
+			raised = i;
+			break;
+		}
+	}
+	if (raised < n)
+	{
+		manager.sortedRows(SortKey::Salary);
+		manager.setWorkingDays(raised, 1000000);
+		const RosterOrder &order = manager.getOrder();
+		ok = ok && !order.isCached(SortKey::Salary) && order.isCached(SortKey::Name) && order.isCached(SortKey::BirthDate);
+		ok = ok && manager.topEarners(1) == vector<size_t>{raised} && manager.sortedRows(SortKey::Salary)[0] == raised;
+	}
+
+	printf("employees: %zu\n", n);
+	printf("salary, radix:      %10.1f ms   stable_sort %.1f ms  (%.1fx)\n", salaryMs, salaryRefMs, salaryRefMs / salaryMs);
+	printf("birth date, radix:  %10.1f ms   stable_sort %.1f ms  (%.1fx, radix includes date parsing)\n", dateMs, dateRefMs, dateRefMs / dateMs);
+	printf("name:               %10.1f ms\n", nameMs);
+	printf("cached salary:      %10.1f us\n", cachedUs);
+	printf("top %zu earners:     %10.3f ms   full sort %.1f ms\n", topN, topMs, salaryMs);
+	printf("results match:      %s\n", ok ? "yes" : "NO");
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,71 @@
+#include <iostream>
+#include <vector>
+#include "BenchUtil.h"
+#include "VariantEmployeeManagement.h"
+
+using namespace std;
+
+// Payroll throughput of virtual dispatch over vector<Employee *> against
+// the std::variant backend with std::visit.
+//
+// Usage: variant_bench [employees]
+
+int main(int argc, char **argv)
+{
+	size_t n = benchSizeArg(argc, argv, 1000000);
+	const int reps = 20;
+
+	vector<Employee *> pointers;
+	pointers.reserve(n);
+	VariantEmployeeManagement variants;
+	variants.reserve(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		string name = syntheticName(i);
+		string birthDate = syntheticBirthDate(i);
+		int units = syntheticUnits(i);
+		if (syntheticType(i) == EmployeeType::Office)
+		{
+			pointers.push_back(new OfficeEmployee(name, birthDate, units));
+			variants.addOfficeEmployee(name, birthDate, units);
+		}
+		else
+		{
+			pointers.push_back(new Worker(name, birthDate, units));
+			variants.addWorker(name, birthDate, units);
+		}
+	}
+
+	double virtualTotal = 0;
+	BenchTimer virtualTimer;
+	for (int r = 0; r < reps; r++)
+	{
+		double total = 0;
+		for (Employee *e : pointers)
+		{
+			total += e->calculateSalary();
+		}
+		virtualTotal = total;
+	}
+	double virtualNs = virtualTimer.elapsedNs() / reps / n;
+
+	double variantTotal = 0;
+	BenchTimer variantTimer;
+	for (int r = 0; r < reps; r++)
+	{
+		variantTotal = variants.calculateTotalSalary();
+	}
+	double variantNs = variantTimer.elapsedNs() / reps / n;
+
+	cout << "employees:        " << n << "\n";
+	cout << "virtual dispatch: " << virtualNs << " ns/employee (" << 1e3 / virtualNs << " M/s)\n";
+	cout << "std::visit:       " << variantNs << " ns/employee (" << 1e3 / variantNs << " M/s)\n";
+	cout << "speedup:          " << virtualNs / variantNs << "x\n";
+	cout << "totals match:     " << (virtualTotal == variantTotal ? "yes" : "NO") << "\n";
+
+	for (Employee *e : pointers)
+	{
+		delete e;
+	}
+	return virtualTotal == variantTotal ? 0 : 1;
+}
@@ -1,5 +1,9 @@
 #include <iostream>
+#include <fstream>
 #include "EmployeeManagement.cpp"
+#include "Instrumentation.h"
+#include "PayrollPipeline.h"
+#include "ScriptRunner.h"
 
 using namespace std;
 
@@ -13,14 +17,216 @@ void displayMenu()
 	cout << "  [1] Register Employees\n";
 	cout << "  [2] Display All Employees\n";
 	cout << "  [3] Calculate Total Salary\n";
+	cout << "  [4] Import Roster File (CSV/TSV)\n";
+	cout << "  [5] Display Employees by Range\n";
+	cout << "  [6] Save Roster Snapshot\n";
+	cout << "  [7] Load Roster Snapshot\n";
+	cout << "  [8] Find Employees by Birth Year\n";
+	cout << "  [9] Calculate Payroll by Pay Schedule\n";
+	cout << "  [10] Payroll Statistics\n";
+	cout << "  [11] Run Payroll File (CSV/TSV)\n";
+	cout << "  [12] Dump Instrumentation (JSON)\n";
+	cout << "  [13] Open Roster Journal\n";
+	cout << "  [14] Close Payroll Period\n";
+	cout << "  [15] What-If Payroll Scenarios\n";
+	cout << "  [16] Sorted Employees / Top Earners\n";
 	cout << "  [0] Exit\n";
 	cout << "\n";
 	cout << "  Your choice: ";
 }
 
-int main()
+void displayStatistics(EmployeeManagement &manager)
+{
+	AggregationSpec spec;
+	spec.groupByType = true;
+	spec.percentiles = {0.5, 0.9, 0.99};
+	spec.topK = 5;
+	PayrollAggregation stats = manager.aggregate(spec, 0);
+
+	cout << "\n";
+	cout << "  +-----------------------------+\n";
+	cout << "  |     PAYROLL STATISTICS      |\n";
+	cout << "  +-----------------------------+\n";
+	for (const SalaryAggregate &group : stats.groups())
+	{
+		cout << "  | " << (group.type == EmployeeType::Office ? "Office Employees" : "Workers") << ": " << group.count << "\n";
+		cout << "  |   Total:  $" << group.total << "\n";
+		cout << "  |   Min:    $" << group.min << "\n";
+		cout << "  |   Mean:   $" << group.mean << "\n";
+		cout << "  |   Median: $" << group.percentiles[0] << "\n";
+		cout << "  |   P90:    $" << group.percentiles[1] << "\n";
+		cout << "  |   P99:    $" << group.percentiles[2] << "\n";
+		cout << "  |   Max:    $" << group.max << "\n";
+		cout << "  +-----------------------------+\n";
+	}
+	cout << "  | Top Earners:\n";
+	for (const TopEarner &earner : stats.topEarners())
+	{
+		cout << "  |   #" << earner.row + 1 << " " << manager.getEmployee(earner.row)->getName()
+				 << ": $" << earner.salary << "\n";
+	}
+	cout << "  +-----------------------------+\n";
+}
+
+void runPayrollFile()
+{
+	string rosterPath, outputPath;
+	cout << "\n  Roster file path: ";
+	getline(cin, rosterPath);
+	cout << "  Payroll output path: ";
+	getline(cin, outputPath);
+
+	ofstream out(outputPath, ios::binary);
+	if (!out)
+	{
+		cout << "\n  [!] Cannot write " << outputPath << "\n";
+		return;
+	}
+	PayrollPipeline pipeline(out);
+	if (!pipeline.run(rosterPath))
+	{
+		cout << "\n  [!] " << pipeline.getError() << "\n";
+		return;
+	}
+
+	const PipelineStats &stats = pipeline.getStats();
+	cout << "\n";
+	cout << "========================================\n";
+	cout << "   Payroll Run Complete: " << stats.rows << " employee(s)\n";
+	if (stats.rejected > 0)
+	{
+		cout << "   Rejected lines: " << stats.rejected << "\n";
+	}
+	cout << "   Total Payroll: $" << stats.totalSalary << "\n";
+	cout << "========================================\n";
+}
+
+void openJournal(EmployeeManagement &manager)
+{
+	string basePath;
+	cout << "\n  Journal base path (e.g. roster): ";
+	getline(cin, basePath);
+
+	string error;
+	if (!manager.openJournal(basePath, RosterJournal::Options(), error))
+	{
+		cout << "\n  [!] " << error << "\n";
+		return;
+	}
+	RosterJournal *journal = manager.getJournal();
+	cout << "\n  [OK] Recovered " << manager.size() << " employee(s), replayed "
+			 << journal->getReplayedRecords() << " journal record(s)\n";
+	cout << "       Changes are now logged to " << journal->getJournalPath() << "\n";
+}
+
+void closePayrollPeriod(EmployeeManagement &manager)
+{
+	int year, month;
+	cout << "\n  Period year and month (e.g. 2024 3): ";
+	cin >> year >> month;
+	cin.ignore();
+
+	if (!manager.closePayrollPeriod(year, month))
+	{
+		cout << "\n  [!] " << manager.getHistory().getError() << "\n";
+		return;
+	}
+	const PayrollHistory &history = manager.getHistory();
+	int64_t yearToDate = 0;
+	for (int m = 1; m <= month; m++)
+	{
+		yearToDate += history.totalSalary(year, m);
+	}
+	cout << "\n";
+	cout << "  +-----------------------------+\n";
+	cout << "  |  PAYROLL PERIOD " << year << "-" << (month < 10 ? "0" : "") << month << "     |\n";
+	cout << "  +-----------------------------+\n";
+	cout << "  | Period Payroll: $" << history.totalSalary(year, month) << "\n";
+	cout << "  | Year to Date:   $" << yearToDate << "\n";
+	cout << "  | Periods Kept:   " << history.periods() << " (" << history.bytesUsed() << " bytes)\n";
+	cout << "  +-----------------------------+\n";
+}
+
+void runScenarios(EmployeeManagement &manager)
+{
+	size_t count;
+	cout << "\n  Number of scenarios: ";
+	cin >> count;
+	cin.ignore();
+
+	PayrollScenarios scenarios;
+	for (size_t i = 0; i < count; i++)
+	{
+		PayrollScenario scenario;
+		scenario.name = "Scenario " + to_string(i + 1);
+		cout << "  " << scenario.name << " - daily rate, product rate: ";
+		cin >> scenario.office.rate >> scenario.worker.rate;
+		scenarios.add(scenario);
+	}
+	cin.ignore();
+
+	vector<ScenarioResult> results = manager.runScenarios(scenarios);
+	double current = manager.calculateTotalSalary();
+	cout << "\n";
+	cout << "  +-----------------------------+\n";
+	cout << "  |     WHAT-IF SCENARIOS       |\n";
+	cout << "  +-----------------------------+\n";
+	cout << "  | Current Payroll: $" << current << "\n";
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		double change = results[i].totalSalary - current;
+		cout << "  | " << scenarios.at(i).name << ": $" << results[i].totalSalary << " (" << (change >= 0 ? "+" : "") << change
+				 << ")\n";
+	}
+	cout << "  +-----------------------------+\n";
+}
+
+void displaySorted(EmployeeManagement &manager)
+{
+	int choice;
+	size_t count;
+	cout << "\n";
+	cout << "  [1] By Salary (highest first)\n";
+	cout << "  [2] By Name\n";
+	cout << "  [3] By Birth Date (oldest first)\n";
+	cout << "  [4] Top Earners\n";
+	cout << "\n  Your choice: ";
+	cin >> choice;
+	cout << "  How many employees to show? ";
+	cin >> count;
+	cin.ignore();
+
+	switch (choice)
+	{
+	case 1:
+		manager.displaySorted(SortKey::Salary, 0, count);
+		break;
+	case 2:
+		manager.displaySorted(SortKey::Name, 0, count);
+		break;
+	case 3:
+		manager.displaySorted(SortKey::BirthDate, 0, count);
+		break;
+	case 4:
+		manager.displayRows(manager.topEarners(count));
+		break;
+	default:
+		cout << "\n  [!] Invalid choice.\n";
+	}
+}
+
+// employee_demo --script [file] runs a command script (see ScriptRunner.h)
+// from file, or from standard input, instead of the interactive menu.
+int main(int argc, char **argv)
 {
 	EmployeeManagement manager;
+	if (argc > 1 && string(argv[1]) == "--script")
+	{
+		ScriptRunner runner(manager, cout, cerr);
+		bool read = runner.runFile(argc > 2 ? argv[2] : "-");
+		return read && runner.getErrors() == 0 ? 0 : 1;
+	}
+
 	int choice;
 
 	do
@@ -45,7 +251,113 @@ int main()
 			cout << "  | Total Payroll: $" << manager.calculateTotalSalary() << "\n";
 			cout << "  +-----------------------------+\n";
 			break;
+		case 4:
+		{
+			string path;
+			cout << "\n  Roster file path: ";
+			getline(cin, path);
+			manager.importFile(path);
+			break;
+		}
+		case 5:
+		{
+			size_t first, last;
+			cout << "\n  From employee #: ";
+			cin >> first;
+			cout << "  To employee #:   ";
+			cin >> last;
+			cin.ignore();
+			manager.displayRange(first, last);
+			break;
+		}
+		case 6:
+		case 7:
+		{
+			string path;
+			cout << "\n  Snapshot file path: ";
+			getline(cin, path);
+			if (choice == 6)
+			{
+				manager.saveSnapshot(path);
+			}
+			else
+			{
+				manager.loadSnapshot(path);
+			}
+			break;
+		}
+		case 8:
+		{
+			int fromYear, toYear, type;
+			cout << "\n  Born from year: ";
+			cin >> fromYear;
+			cout << "  Born to year:   ";
+			cin >> toYear;
+			cout << "  Type (0 = any, 1 = office, 2 = worker): ";
+			cin >> type;
+			cin.ignore();
+			if (type == 1 || type == 2)
+			{
+				manager.displayRows(manager.findBornBetween(fromYear, toYear, static_cast<EmployeeType>(type)));
+			}
+			else
+			{
+				manager.displayRows(manager.findBornBetween(fromYear, toYear));
+			}
+			break;
+		}
+		case 9:
+		{
+			cout << "\n";
+			for (size_t i = 0; i < PayPolicy::count(); i++)
+			{
+				cout << "  [" << i + 1 << "] " << PayPolicy::all()[i].name << " - " << PayPolicy::all()[i].description << "\n";
+			}
+			size_t schedule;
+			cout << "\n  Pay schedule: ";
+			cin >> schedule;
+			cin.ignore();
+			if (schedule < 1 || schedule > PayPolicy::count())
+			{
+				cout << "\n  [!] Invalid pay schedule.\n";
+				break;
+			}
+			const PayPolicy &policy = PayPolicy::all()[schedule - 1];
+			cout << "\n";
+			cout << "  +-----------------------------+\n";
+			cout << "  |       SALARY SUMMARY        |\n";
+			cout << "  +-----------------------------+\n";
+			cout << "  | Pay Schedule: " << policy.name << "\n";
+			cout << "  | Total Payroll: $" << manager.calculateTotalSalary(policy) << "\n";
+			cout << "  +-----------------------------+\n";
+			break;
+		}
+		case 10:
+			displayStatistics(manager);
+			break;
+		case 11:
+			runPayrollFile();
+			break;
+		case 12:
+			cout << "\n" << Instrumentation::toJson() << "\n";
+			break;
+		case 13:
+			openJournal(manager);
+			break;
+		case 14:
+			closePayrollPeriod(manager);
+			break;
+		case 15:
+			runScenarios(manager);
+			break;
+		case 16:
+			displaySorted(manager);
+			break;
 		case 0:
+			if (!manager.commitJournal())
+			{
+				cout << "\n  [!] " << manager.getJournal()->getError() << "\n";
+			}
 			cout << "\n";
 			cout << "========================================\n";
 			cout << "    Thank you for using the system!     \n";